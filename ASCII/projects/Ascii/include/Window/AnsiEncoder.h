@@ -0,0 +1,58 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_ANSIENCODER_H
+#define ASCII_WINDOW_ANSIENCODER_H
+
+#include <string>
+
+#include "Window/Window.h"
+
+// Turns frames into the VT/ANSI escape sequences that update a terminal from the previous frame.
+// Only changed cells are written, the cursor is moved with whichever sequence is shortest and
+// colors are only set when they differ from what the terminal is already using.
+class AnsiFrameEncoder {
+public:
+  AnsiFrameEncoder(void);
+
+  // Sets the PaletteColorCount colors cells are drawn with, written as 24-bit SGR codes. The next
+  // frame only rewrites the cells showing a color that changed, so animated palettes cost what they
+  // change. TransparentColor shows color 0, as it does over an empty window.
+  void SetPalette(Color const * colors);
+
+  // Forgets what the terminal shows, so the next frame clears the screen and is written in full.
+  void Invalidate(void);
+
+  // Appends the bytes that turn the previous frame into draw.
+  void Encode(Grid<AsciiCell, 2> const & draw, std::string & io_output);
+
+  // Cells the last Encode wrote, including unchanged ones rewritten instead of moving the cursor.
+  int GetWrittenCells(void) const;
+
+private:
+  void MoveCursor(Grid<AsciiCell, 2> const & draw, ivec2 const & target, std::string & io_output);
+  void SetColors(AsciiCell const & cell, std::string & io_output);
+  void WriteCell(AsciiCell const & cell, std::string & io_output);
+  bool CanRewriteCell(AsciiCell const & cell) const;
+  bool IsRecolored(AsciiCell const & cell) const;
+  void BuildColorCodes(int index);
+
+  Color              m_palette[PaletteColorCount];
+  bool               m_changedColors[PaletteColorCount] = {};
+  bool               m_hasChangedColors                 = false;
+  std::string        m_colorCodes[2][PaletteColorCount];
+  Grid<AsciiCell, 2> m_previous;
+  bool               m_isValid       = false;
+  ivec2              m_cursor;
+  bool               m_isCursorKnown = false;
+  int                m_foreground    = -1;
+  int                m_background    = -1;
+  int                m_writtenCells  = 0;
+};
+
+// The UTF-8 text a terminal needs to show the block font's glyph for character. The block font
+// follows code page 437.
+char const * GetAnsiGlyphText(unsigned char character);
+
+#endif // ASCII_WINDOW_ANSIENCODER_H
@@ -0,0 +1,34 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_ANSIINPUT_H
+#define ASCII_WINDOW_ANSIINPUT_H
+
+#include <string>
+#include <vector>
+
+#include "Window/Window.h"
+
+// Turns the bytes a terminal sends in raw mode into input events. Terminals only report presses,
+// so each key becomes a down and an up event wrapped in state events for its modifiers. Mouse
+// input is read from SGR mouse reports, with positions in cells.
+class AnsiInputParser {
+public:
+  // Sequences cut off at the end of bytes are held back and finished by the next call.
+  void Parse(char const * bytes, int count, std::vector<AsciiInputEvent> & io_events);
+
+  // Escape on its own can't be told apart from the start of a sequence until nothing follows it,
+  // so call this once input goes quiet to report a held back escape key.
+  void Flush(std::vector<AsciiInputEvent> & io_events);
+
+private:
+  // Returns how many bytes starting at begin made up the sequence, or 0 if it isn't complete yet.
+  int ParseEscape(int begin, std::vector<AsciiInputEvent> & io_events);
+  void ParseMouse(std::string const & parameters, bool isRelease, std::vector<AsciiInputEvent> & io_events);
+
+  std::string m_pending;
+  ivec2       m_mousePosition = ivec2(-1, -1);
+};
+
+#endif // ASCII_WINDOW_ANSIINPUT_H
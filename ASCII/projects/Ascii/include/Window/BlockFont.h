@@ -7,6 +7,13 @@
 
 #include "Math/Vector.h"
 
+// The font compiled into the library, used when no glyph atlas has been loaded.
+ivec2                 GetBlockFontGlyphSize(void);
+unsigned char const * GetBlockFontSheet(void);
+
+// The glyph size and sheet of the current glyph atlas, at one byte per pixel. The sheet holds every
+// page of the atlas, laid out as GlyphAtlas.h describes, and stays valid until the atlas is
+// replaced.
 ivec2                 GetGlyphSize(void);
 unsigned char const * GetGlyphSheet(void);
 
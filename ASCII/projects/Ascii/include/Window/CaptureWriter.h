@@ -0,0 +1,28 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_CAPTUREWRITER_H
+#define ASCII_WINDOW_CAPTUREWRITER_H
+
+#include <ostream>
+#include <string>
+
+#include "Window/Window.h"
+
+// Writes captured frames to output as back to back binary PPM images, which ffmpeg reads with
+// "-f image2pipe -c:v ppm". Each image carries its own size, so the window can resize mid capture.
+class PpmCaptureWriter {
+public:
+  PpmCaptureWriter(std::shared_ptr<std::ostream> const & output);
+
+  void Write(AsciiCapturedFrame const & frame);
+
+  int64_t GetWrittenFrames(void) const;
+
+private:
+  std::shared_ptr<std::ostream> m_output;
+  int64_t                       m_writtenFrames = 0;
+};
+
+#endif // ASCII_WINDOW_CAPTUREWRITER_H
@@ -0,0 +1,51 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_CELLDIFF_H
+#define ASCII_WINDOW_CELLDIFF_H
+
+#include <vector>
+
+#include "Window/Window.h"
+
+struct CellSpan {
+  CellSpan(void) = default;
+  CellSpan(int begin, int end) :
+    begin(begin),
+    end(end)
+  {}
+
+  bool operator ==(CellSpan const &) const = default;
+
+  int Count(void) const {
+    return end - begin;
+  }
+
+  int begin = 0;
+  int end   = 0;
+};
+
+// Spans closer than mergeDistance cells are joined, since uploading a few
+// unchanged cells is cheaper than another call into the driver.
+void FindChangedCellSpans(
+  AsciiCell const *       previous,
+  AsciiCell const *       current,
+  int                     count,
+  int                     mergeDistance,
+  std::vector<CellSpan> & o_spans
+);
+
+// Packed cells are compared a whole word at a time, several cells per instruction where SSE2 is
+// available.
+void FindChangedCellSpans(
+  AsciiPackedCell const * previous,
+  AsciiPackedCell const * current,
+  int                     count,
+  int                     mergeDistance,
+  std::vector<CellSpan> & o_spans
+);
+
+int CountSpanCells(std::vector<CellSpan> const & spans);
+
+#endif // ASCII_WINDOW_CELLDIFF_H
@@ -0,0 +1,56 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_FRAMECODEC_H
+#define ASCII_WINDOW_FRAMECODEC_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Window/Window.h"
+
+// Appends current to io_bytes as the cells that differ from previous. Each changed span is stored
+// as runs of identical cells, which is what most screens are made of.
+void EncodeFrameDelta(
+  AsciiCell const *            previous,
+  AsciiCell const *            current,
+  int                          count,
+  std::vector<unsigned char> & io_bytes
+);
+
+// Applies one encoded frame to io_cells and advances io_read past it. Returns false if the bytes
+// run out or don't fit count cells.
+bool DecodeFrameDelta(
+  unsigned char const * & io_read,
+  unsigned char const *   end,
+  AsciiCell *             io_cells,
+  int                     count
+);
+
+void WriteVarUint(uint64_t value, std::vector<unsigned char> & io_bytes);
+bool ReadVarUint(unsigned char const * & io_read, unsigned char const * end, uint64_t & o_value);
+
+// Recordings start with RecordingMagic and the version, and are then a list of records, each a
+// type byte, the microseconds since the previous record, the payload size and the payload.
+// Version 2 added palette banks and cycles to font records, and version 3 resize input events.
+static char const     RecordingMagic[]   = "ASCIIREC";
+static int const      RecordingMagicSize = 8;
+static uint64_t const RecordingVersion   = 3;
+
+enum class RecordType : unsigned char {
+  Frame = 1,
+  Input = 2,
+  Font  = 3,
+};
+
+void WriteInputEvent(AsciiInputEvent const & event, std::vector<unsigned char> & io_bytes);
+bool ReadInputEvent(unsigned char const * & io_read, unsigned char const * end, AsciiInputEvent & o_event);
+
+void WriteFont(AsciiFont const & font, std::vector<unsigned char> & io_bytes);
+
+// Fonts from before version 2 only have FontColorCount colors and no cycles. The rest of o_font is
+// left as it is.
+bool ReadFont(unsigned char const * & io_read, unsigned char const * end, AsciiFont & o_font, uint64_t version = RecordingVersion);
+
+#endif // ASCII_WINDOW_FRAMECODEC_H
@@ -0,0 +1,75 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_FRAMESTATS_H
+#define ASCII_WINDOW_FRAMESTATS_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Window/FrameTimeRecorder.h"
+
+// Where one frame's time went. A frame runs from the end of one draw to the end of the next, so it
+// holds the input polling and sleeping that led up to its draw. Times are in nanoseconds of the
+// window's run clock, so SoftwareAsciiWindow reports its virtual time.
+struct AsciiFrameStats {
+  int64_t frameNs       = 0;
+  int64_t drawNs        = 0;
+  int64_t swapNs        = 0;
+  int64_t pollNs        = 0;
+  int64_t sleepNs       = 0;
+  int64_t uploadedCells = 0;
+  int64_t inputEvents   = 0;
+};
+
+// The AsciiFrameStats times that get a FrameTimeRecorder. Counts like uploadedCells are only kept
+// per frame.
+enum class AsciiFrameTime {
+  Frame,
+  Draw,
+  Swap,
+  Poll,
+  Sleep,
+  Count,
+};
+
+// Keeps the stats of the last HistoryCapacity frames, and a FrameTimeRecorder of each time since
+// the last Clear. The recorders are cumulative rather than rolling, since a histogram can't drop a
+// frame without losing its exact min and max; Clear them to start a new window. Windows add to the frame in progress as calls come in and finish it at the end of
+// each draw.
+class FrameStatsRecorder {
+public:
+  static int const HistoryCapacity = 1024;
+
+  // One of the AsciiFrameStats members, like &AsciiFrameStats::drawNs.
+  using Stat = int64_t AsciiFrameStats::*;
+
+  FrameStatsRecorder(void);
+
+  void Clear(void);
+
+  void Add(Stat stat, int64_t amount);
+
+  // runNs is the window's run time. The first frame after a Clear has no start, so its frameNs is 0
+  // and it isn't counted in the frame times.
+  void EndFrame(int64_t runNs);
+
+  int GetFrameCount(void) const;
+
+  // Age 0 is the last finished frame. Ages past the oldest kept frame get the oldest one.
+  AsciiFrameStats const & GetFrame(int age) const;
+
+  // Every frame since the last Clear, not just the kept ones.
+  FrameTimeRecorder const & GetTimes(AsciiFrameTime time) const;
+
+private:
+  std::vector<AsciiFrameStats>   m_history;
+  std::vector<FrameTimeRecorder> m_times;
+  int                            m_nextFrame    = 0;
+  int                            m_frameCount   = 0;
+  AsciiFrameStats                m_currentFrame;
+  int64_t                        m_frameStartNs = -1;
+};
+
+#endif // ASCII_WINDOW_FRAMESTATS_H
@@ -0,0 +1,40 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_FRAMETIMERECORDER_H
+#define ASCII_WINDOW_FRAMETIMERECORDER_H
+
+#include <cstdint>
+#include <vector>
+
+// Collects frame times into a fixed histogram so recording stays cheap for long runs. Percentiles
+// are accurate to the bucket width. Anything past the last bucket is counted in it.
+class FrameTimeRecorder {
+public:
+  static int64_t const BucketNs    = 10000;
+  static int const     BucketCount = 10000;
+
+  FrameTimeRecorder(void);
+
+  void Clear(void);
+  void AddFrame(int64_t frameNs);
+
+  int GetFrameCount(void) const;
+
+  int64_t GetMinNs(void) const;
+  int64_t GetMaxNs(void) const;
+  int64_t GetMeanNs(void) const;
+
+  // percentile is in [0, 1]. Returns the upper edge of the bucket holding that frame.
+  int64_t GetPercentileNs(float percentile) const;
+
+private:
+  std::vector<int> m_buckets;
+  int              m_frameCount = 0;
+  int64_t          m_totalNs    = 0;
+  int64_t          m_minNs      = 0;
+  int64_t          m_maxNs      = 0;
+};
+
+#endif // ASCII_WINDOW_FRAMETIMERECORDER_H
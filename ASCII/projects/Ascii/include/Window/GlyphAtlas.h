@@ -0,0 +1,86 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_GLYPHATLAS_H
+#define ASCII_WINDOW_GLYPHATLAS_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Math/Vector.h"
+
+// Glyph atlas files start with GlyphAtlasMagic, then the version, glyph width, glyph height and page
+// count as little endian 32 bit values, then the glyph sheet exactly as GetGlyphSheet returns it.
+// The sheet can be used straight from the mapped file. Version 1 files have no page count and hold
+// a single page.
+static char const     GlyphAtlasMagic[]    = "ASCIIFNT";
+static int const      GlyphAtlasMagicSize  = 8;
+static uint32_t const GlyphAtlasVersion    = 2;
+static int const      GlyphAtlasHeaderSize = GlyphAtlasMagicSize + 4 * 4;
+
+// Each page is a 16x16 sheet of glyphs, and pages are stacked top to bottom. Glyph n is on page
+// n / 256, and since pages are as wide as each other it's at column n % 16 and row n / 16 of the
+// whole sheet.
+static int const GlyphAtlasPageGlyphCount = 256;
+static int const GlyphAtlasMaxPageCount   = 4;
+
+// A sheet of glyphs, either the compiled in font or a file BlockFontConversion wrote.
+class GlyphAtlas {
+public:
+  // Memory maps the atlas at path. Returns null if it can't be read or isn't a glyph atlas.
+  static std::shared_ptr<GlyphAtlas const> Load(std::string const & path);
+
+  // Wraps a sheet that outlives the atlas, like the compiled in font.
+  GlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet);
+  GlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet, int pageCount);
+
+  ~GlyphAtlas(void);
+
+  GlyphAtlas(GlyphAtlas const &) = delete;
+  GlyphAtlas & operator =(GlyphAtlas const &) = delete;
+
+  ivec2 GetGlyphSize(void) const;
+  unsigned char const * GetGlyphSheet(void) const;
+
+  int GetPageCount(void) const;
+  int GetGlyphCount(void) const;
+
+private:
+  GlyphAtlas(void) = default;
+
+  ivec2                 m_glyphSize;
+  int                   m_pageCount   = 1;
+  unsigned char const * m_sheet       = nullptr;
+  void *                m_mapping     = nullptr;
+  size_t                m_mappingSize = 0;
+};
+
+void WriteGlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet, std::vector<unsigned char> & io_bytes);
+void WriteGlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet, int pageCount, std::vector<unsigned char> & io_bytes);
+
+// Checks the header and size. o_sheet points into bytes.
+bool ParseGlyphAtlas(unsigned char const * bytes, size_t size, ivec2 & o_glyphSize, unsigned char const * & o_sheet);
+bool ParseGlyphAtlas(unsigned char const * bytes, size_t size, ivec2 & o_glyphSize, int & o_pageCount, unsigned char const * & o_sheet);
+
+// The atlas windows draw with. Until one is set, this is the atlas named by the ASCII_GLYPH_ATLAS
+// environment variable if it loads, and the compiled in font otherwise.
+std::shared_ptr<GlyphAtlas const> GetGlyphAtlas(void);
+
+// Windows pick up the new atlas with their next frame. Null goes back to the compiled in font.
+void SetGlyphAtlas(std::shared_ptr<GlyphAtlas const> const & atlas);
+
+// Holds on to the current atlas so code that runs every frame only takes GetGlyphAtlas's lock after
+// SetGlyphAtlas has replaced it. Each thread needs its own.
+class GlyphAtlasCache {
+public:
+  std::shared_ptr<GlyphAtlas const> const & Get(void);
+
+private:
+  std::shared_ptr<GlyphAtlas const> m_atlas;
+  int                               m_generation = -1;
+};
+
+#endif // ASCII_WINDOW_GLYPHATLAS_H
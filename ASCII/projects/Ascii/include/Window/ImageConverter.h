@@ -0,0 +1,67 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_IMAGECONVERTER_H
+#define ASCII_WINDOW_IMAGECONVERTER_H
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Window/GlyphAtlas.h"
+#include "Window/Window.h"
+
+// Turns images into cells that look like them, such as video frames to stream into a window. Each
+// cell gets the glyph and pair of palette colors with the least squared error against its part of
+// the image. Cells are matched at a few samples per axis rather than every pixel of the glyph, so
+// glyphs that only differ in detail finer than that are treated as the same glyph.
+class AsciiImageConverter {
+public:
+  AsciiImageConverter(void);
+
+  // Glyphs are copied out of atlas, so later atlas changes don't affect this converter.
+  AsciiImageConverter(std::shared_ptr<GlyphAtlas const> const & atlas);
+
+  // Fills io_cells at its current size, stretching image over it. Cell colors are indices into
+  // palette, which only uses its first PaletteColorCount colors.
+  void Convert(Grid<Color, 2> const & image, std::span<Color const> palette, Grid<AsciiCell, 2> & io_cells);
+
+  // Rows of cells are split between this many threads, including the calling one. Defaults to the
+  // number of cores.
+  int GetThreadCount(void) const;
+  void SetThreadCount(int threadCount);
+
+  // Glyphs left after dropping ones that look the same at the sample resolution.
+  int GetCandidateCount(void) const;
+
+private:
+  // The pixels [begin, end) of one axis that a sample covers.
+  struct PixelRun {
+    int begin = 0;
+    int end   = 0;
+
+    int Count(void) const {
+      return end - begin;
+    }
+  };
+
+  // Splits size pixels into count runs that are as even as possible. Runs are never empty, so when
+  // there are fewer pixels than runs a run repeats the pixel under its middle.
+  static void FindSampleRuns(int size, int count, std::vector<PixelRun> & o_runs);
+
+  void ConvertRows(Grid<Color, 2> const & image, int beginRow, int endRow, Grid<AsciiCell, 2> & io_cells) const;
+
+  ivec2                      m_sampleSize;
+  int                        m_candidateCount;
+  int                        m_paddedCandidateCount;
+  std::vector<unsigned char> m_candidateGlyphs;
+  std::vector<float>         m_coverage;
+  std::vector<float>         m_coverageSums;
+  std::vector<PixelRun>      m_sampleColumns;
+  std::vector<PixelRun>      m_sampleRows;
+  std::vector<float>         m_paletteTerms;
+  int                        m_threadCount;
+};
+
+#endif // ASCII_WINDOW_IMAGECONVERTER_H
@@ -0,0 +1,17 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_LAYERS_H
+#define ASCII_WINDOW_LAYERS_H
+
+#include <span>
+
+#include "Window/Window.h"
+
+// Flattens layers into a single grid for windows that draw whole cells. A glyph over a transparent
+// background keeps the background of the cell below it, and a transparent glyph takes its color
+// from the background below. Only the GPU window can show the lower layer's glyph around it.
+void CompositeLayers(ivec2 const & size, std::span<AsciiLayer const> layers, Grid<AsciiCell, 2> & o_grid);
+
+#endif // ASCII_WINDOW_LAYERS_H
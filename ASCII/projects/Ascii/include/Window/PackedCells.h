@@ -0,0 +1,23 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_PACKEDCELLS_H
+#define ASCII_WINDOW_PACKEDCELLS_H
+
+#include "Window/Window.h"
+
+// What UnpackCell shows for glyphs past the first page of the glyph atlas.
+static char const UnpackedFallbackCharacter = '?';
+
+// Every AsciiCell has a packed equivalent, so unpacking a packed AsciiCell gives it back.
+AsciiPackedCell PackCell(AsciiCell const & cell);
+
+// Glyphs past the first page become UnpackedFallbackCharacter. Colors too big for a byte are
+// wrapped into the palette, where they pick the same entry they did before.
+AsciiCell UnpackCell(AsciiPackedCell const & cell);
+
+void PackCells(Grid<AsciiCell, 2> const & cells, Grid<AsciiPackedCell, 2> & o_packed);
+void UnpackCells(Grid<AsciiPackedCell, 2> const & packed, Grid<AsciiCell, 2> & o_cells);
+
+#endif // ASCII_WINDOW_PACKEDCELLS_H
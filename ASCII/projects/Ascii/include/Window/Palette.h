@@ -0,0 +1,20 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_PALETTE_H
+#define ASCII_WINDOW_PALETTE_H
+
+#include "Window/Window.h"
+
+// The palette the font's cycles give at runMs, for windows that can't evaluate them on the GPU.
+// o_colors must hold PaletteColorCount colors.
+void EvaluatePalette(AsciiFont const & font, int runMs, Color * o_colors);
+
+// Whether any of the font's cycles changes the palette over time.
+bool IsPaletteAnimated(AsciiFont const & font);
+
+// Whether cycle moves any colors. Cycles must cover at least 2 colors inside the palette.
+bool IsPaletteCycleActive(PaletteCycle const & cycle);
+
+#endif // ASCII_WINDOW_PALETTE_H
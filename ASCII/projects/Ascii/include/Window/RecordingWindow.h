@@ -0,0 +1,75 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_RECORDINGWINDOW_H
+#define ASCII_WINDOW_RECORDINGWINDOW_H
+
+#include <ostream>
+#include <vector>
+
+#include "Window/FrameCodec.h"
+#include "Window/Window.h"
+
+// Passes everything through to another window while writing each drawn grid, input batch and font
+// change to output. Frames are stored as deltas against the previous one, so leaving this on costs
+// about as much as the diff itself. Output is written in large chunks and on destruction.
+class RecordingAsciiWindow : public IAsciiWindow {
+public:
+  RecordingAsciiWindow(std::shared_ptr<IAsciiWindow> const & window, std::shared_ptr<std::ostream> const & output);
+
+  virtual ~RecordingAsciiWindow(void) override;
+
+  virtual void Draw(Grid<AsciiCell, 2> const & draw) override;
+
+  // Layers are recorded as the single grid they composite to.
+  virtual void DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) override;
+
+  // Recordings hold AsciiCell frames, so packed cells are recorded as UnpackCell makes them.
+  virtual void DrawPacked(Grid<AsciiPackedCell, 2> const & draw) override;
+
+  virtual Grid<AsciiCell, 2> & AcquireBackbuffer(void) override;
+
+  virtual std::vector<AsciiInputEvent> PollInput(void) override;
+  virtual std::span<AsciiInputEvent const> DrainInput(void) override;
+
+  virtual std::string GetClipboard(void) const override;
+  virtual void SetClipboard(std::string const & clipboard) override;
+
+  virtual std::string GetTitle(void) const override;
+  virtual void SetTitle(std::string const & title) override;
+
+  virtual AsciiFont GetFont(void) const override;
+  virtual void SetFont(AsciiFont const & font) override;
+
+  virtual int GetRunMs(void) const override;
+  virtual void Sleep(int milliseconds) override;
+
+  virtual int64_t GetRunUs(void) const override;
+  virtual int64_t GetRunNs(void) const override;
+  virtual void SleepUntilNs(int64_t runNs) override;
+
+  // The wrapped window's stats. Recording isn't counted in them.
+  virtual FrameStatsRecorder const & GetFrameStats(void) const override;
+
+  void Flush(void);
+
+  // Includes bytes still waiting to be flushed.
+  int64_t GetRecordedBytes(void) const;
+
+private:
+  void RecordFrame(Grid<AsciiCell, 2> const & frame);
+  void WriteRecord(RecordType type);
+  void RecordInput(std::span<AsciiInputEvent const> events);
+
+  std::shared_ptr<IAsciiWindow> m_window;
+  std::shared_ptr<std::ostream> m_output;
+  std::vector<unsigned char>    m_pending;
+  std::vector<unsigned char>    m_payload;
+  Grid<AsciiCell, 2>            m_previousFrame;
+  Grid<AsciiCell, 2>            m_compositedFrame;
+  int64_t                       m_lastRecordUs = 0;
+  int64_t                       m_flushedBytes = 0;
+};
+
+#endif // ASCII_WINDOW_RECORDINGWINDOW_H
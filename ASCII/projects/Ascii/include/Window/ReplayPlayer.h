@@ -0,0 +1,62 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_REPLAYPLAYER_H
+#define ASCII_WINDOW_REPLAYPLAYER_H
+
+#include <istream>
+#include <vector>
+
+#include "Window/FrameCodec.h"
+#include "Window/Window.h"
+
+enum class ReplaySpeed {
+  Original,
+  Max,
+};
+
+// Streams a recording from RecordingAsciiWindow back through a window. Records are read one at a
+// time, so the whole file never has to fit in memory.
+class ReplayPlayer {
+public:
+  ReplayPlayer(std::shared_ptr<IAsciiWindow> const & window, std::shared_ptr<std::istream> const & input);
+
+  // False if the input isn't a recording, or is one from a newer version than this.
+  bool IsValid(void) const;
+
+  // Applies the next record. Returns false at the end of the recording or on a corrupt record.
+  bool Step(void);
+
+  // Steps until the end. Original waits for each frame's recorded time before drawing it.
+  void Play(ReplaySpeed speed);
+
+  Grid<AsciiCell, 2> const & GetFrame(void) const;
+  int GetFrameCount(void) const;
+
+  // Input recorded with the last applied input record.
+  std::vector<AsciiInputEvent> const & GetLastInput(void) const;
+
+  // Microseconds from the start of the recording to the last applied record.
+  int64_t GetRecordUs(void) const;
+
+private:
+  bool ReadHeaderVarUint(uint64_t & o_value);
+  bool ReadPayload(uint64_t payloadSize);
+  bool ApplyRecord(RecordType type);
+
+  std::shared_ptr<IAsciiWindow> m_window;
+  std::shared_ptr<std::istream> m_input;
+  std::vector<unsigned char>    m_payload;
+  Grid<AsciiCell, 2>            m_frame;
+  std::vector<AsciiInputEvent>  m_lastInput;
+  bool                          m_isValid    = false;
+  uint64_t                      m_version    = 0;
+  int64_t                       m_inputEnd   = -1;
+  int                           m_frameCount = 0;
+  int64_t                       m_recordUs   = 0;
+  ReplaySpeed                   m_speed      = ReplaySpeed::Max;
+  int64_t                       m_startNs    = 0;
+};
+
+#endif // ASCII_WINDOW_REPLAYPLAYER_H
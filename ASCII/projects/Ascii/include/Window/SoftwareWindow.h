@@ -0,0 +1,106 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_SOFTWAREWINDOW_H
+#define ASCII_WINDOW_SOFTWAREWINDOW_H
+
+#include <vector>
+
+#include "Window/CellDiff.h"
+#include "Window/GlyphAtlas.h"
+#include "Window/Window.h"
+
+// Rasterizes on the CPU instead of through OpenGL, on a clock that only moves when told to, so runs
+// are deterministic.
+class SoftwareAsciiWindow : public IAsciiWindow {
+public:
+  SoftwareAsciiWindow(void);
+
+  // Glyphs are copied out of atlas, so later atlas changes don't affect this window.
+  SoftwareAsciiWindow(std::shared_ptr<GlyphAtlas const> const & atlas);
+
+  virtual ~SoftwareAsciiWindow(void) override = default;
+
+  virtual void Draw(Grid<AsciiCell, 2> const & draw) override;
+  // Layers are composited a whole cell at a time.
+  virtual void DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) override;
+  virtual void DrawPacked(Grid<AsciiPackedCell, 2> const & draw) override;
+
+  virtual Grid<AsciiCell, 2> & AcquireBackbuffer(void) override;
+
+  virtual std::vector<AsciiInputEvent> PollInput(void) override;
+  virtual std::span<AsciiInputEvent const> DrainInput(void) override;
+
+  virtual std::string GetClipboard(void) const override;
+  virtual void SetClipboard(std::string const & clipboard) override;
+
+  virtual std::string GetTitle(void) const override;
+  virtual void SetTitle(std::string const & title) override;
+
+  virtual AsciiFont GetFont(void) const override;
+  virtual void SetFont(AsciiFont const & font) override;
+
+  // Time only moves through Sleep, SleepUntilNs, SetRunMs and AdvanceRunMs, and none of them take
+  // real time.
+  virtual int GetRunMs(void) const override;
+  virtual void Sleep(int milliseconds) override;
+
+  virtual int64_t GetRunUs(void) const override;
+  virtual int64_t GetRunNs(void) const override;
+  virtual void SleepUntilNs(int64_t runNs) override;
+
+  // Times are on the window's clock, and rasterized cells count as uploaded.
+  virtual FrameStatsRecorder const & GetFrameStats(void) const override;
+
+  void SetRunMs(int runMs);
+  void AdvanceRunMs(int milliseconds);
+
+  void QueueInput(AsciiInputEvent const & event);
+
+  // Resizes the window as if its user had, queueing a Resize event. Until this or a draw sets it,
+  // the window has no size.
+  void Resize(ivec2 const & size);
+
+  Grid<Color, 2> const & GetFramebuffer(void) const;
+
+  // Cells redrawn by the last draw, because they changed or one of their colors did.
+  int GetRasterizedCells(void) const;
+
+private:
+  void Rasterize(Grid<AsciiPackedCell, 2> const & draw);
+  void RasterizeCell(int index, AsciiPackedCell const & cell);
+
+  // Evaluates the font's palette at the current time, so cycles move at each draw. Returns whether
+  // any color changed.
+  bool UpdatePalette(void);
+  void BuildColorRows(void);
+
+  void EndDraw(int64_t drawStartNs);
+
+  ivec2                        m_glyphSize;
+  int                          m_glyphRowBytes;
+  int                          m_glyphCount;
+  std::vector<unsigned char>   m_glyphMasks;
+  std::vector<unsigned char>   m_colorRows;
+  ivec2                        m_size;
+  Grid<AsciiCell, 2>           m_backbuffer;
+  Grid<Color, 2>               m_framebuffer;
+  // Kept packed, so cells on every page of the glyph atlas can be drawn.
+  Grid<AsciiPackedCell, 2>     m_rasterizedGrid;
+  Grid<AsciiCell, 2>           m_compositedGrid;
+  Grid<AsciiPackedCell, 2>     m_packedGrid;
+  std::vector<CellSpan>        m_changedSpans;
+  int                          m_rasterizedCells = 0;
+  std::vector<AsciiInputEvent> m_pendingInput;
+  std::vector<AsciiInputEvent> m_drainedInput;
+  std::string                  m_clipboard;
+  std::string                  m_title;
+  AsciiFont                    m_font;
+  Color                        m_palette[PaletteColorCount];
+  bool                         m_changedColors[PaletteColorCount] = {};
+  int64_t                      m_runNs = 0;
+  FrameStatsRecorder           m_frameStats;
+};
+
+#endif // ASCII_WINDOW_SOFTWAREWINDOW_H
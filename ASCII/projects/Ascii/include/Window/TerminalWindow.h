@@ -0,0 +1,93 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef ASCII_WINDOW_TERMINALWINDOW_H
+#define ASCII_WINDOW_TERMINALWINDOW_H
+
+#include <vector>
+
+#include "Window/AnsiEncoder.h"
+#include "Window/AnsiInput.h"
+#include "Window/Window.h"
+
+// Draws to the VT/ANSI terminal on stdout and reads input from stdin, so tools can run over SSH
+// without a display. The terminal is switched to raw mode on its alternate screen while the window
+// exists and restored when it is destroyed. Each frame only sends what changed since the last.
+// Frame stats count writing to the terminal as the swap, and written cells as uploaded.
+class TerminalAsciiWindow : public IAsciiWindow {
+public:
+  TerminalAsciiWindow(void);
+
+  virtual ~TerminalAsciiWindow(void) override;
+
+  TerminalAsciiWindow(TerminalAsciiWindow const &) = delete;
+  TerminalAsciiWindow & operator =(TerminalAsciiWindow const &) = delete;
+
+  virtual void Draw(Grid<AsciiCell, 2> const & draw) override;
+  virtual void DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) override;
+
+  // Terminals only have the first page of glyphs, so packed cells are drawn unpacked.
+  virtual void DrawPacked(Grid<AsciiPackedCell, 2> const & draw) override;
+
+  virtual Grid<AsciiCell, 2> & AcquireBackbuffer(void) override;
+
+  virtual std::vector<AsciiInputEvent> PollInput(void) override;
+  virtual std::span<AsciiInputEvent const> DrainInput(void) override;
+
+  // Setting the clipboard also sends it to the terminal with OSC 52, which reaches the local
+  // clipboard through SSH on terminals that allow it. Reading only sees what was set here.
+  virtual std::string GetClipboard(void) const override;
+  virtual void SetClipboard(std::string const & clipboard) override;
+
+  virtual std::string GetTitle(void) const override;
+  virtual void SetTitle(std::string const & title) override;
+
+  // Only the colors are used. Glyph size is up to the terminal.
+  virtual AsciiFont GetFont(void) const override;
+  virtual void SetFont(AsciiFont const & font) override;
+
+  virtual int GetRunMs(void) const override;
+  virtual void Sleep(int milliseconds) override;
+
+  virtual int64_t GetRunUs(void) const override;
+  virtual int64_t GetRunNs(void) const override;
+  virtual void SleepUntilNs(int64_t runNs) override;
+
+  virtual FrameStatsRecorder const & GetFrameStats(void) const override;
+
+  // Size of the terminal in cells. This asks the terminal, while resizes are noticed through a
+  // signal and reported as Resize input events.
+  ivec2 GetTerminalSize(void) const;
+
+  // Bytes written to the terminal so far.
+  int64_t GetWrittenBytes(void) const;
+
+private:
+  struct Impl;
+
+  void ReadInput(void);
+  void CheckResize(void);
+
+  // Encodes and writes draw, ending the frame that started at drawStartNs.
+  void Present(Grid<AsciiCell, 2> const & draw, int64_t drawStartNs);
+  void Write(std::string const & bytes);
+
+  std::unique_ptr<Impl>        m_impl;
+  AnsiFrameEncoder             m_encoder;
+  AnsiInputParser              m_parser;
+  std::string                  m_output;
+  Grid<AsciiCell, 2>           m_compositedGrid;
+  Grid<AsciiCell, 2>           m_unpackedGrid;
+  Grid<AsciiCell, 2>           m_backbuffer;
+  std::vector<AsciiInputEvent> m_input;
+  std::vector<AsciiInputEvent> m_drainedInput;
+  ivec2                        m_terminalSize;
+  int64_t                      m_writtenBytes = 0;
+  std::string                  m_clipboard;
+  std::string                  m_title;
+  AsciiFont                    m_font;
+  FrameStatsRecorder           m_frameStats;
+};
+
+#endif // ASCII_WINDOW_TERMINALWINDOW_H
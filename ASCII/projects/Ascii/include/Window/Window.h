@@ -5,22 +5,52 @@
 #ifndef ASCII_WINDOW_WINDOW_H
 #define ASCII_WINDOW_WINDOW_H
 
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
 #include <memory>
+#include <span>
 #include <string>
 
 #include "General/Color.h"
 #include "Containers/Grid.h"
 #include "Math/Vector.h"
+#include "Window/FrameStats.h"
+#include "Window/FrameTimeRecorder.h"
 
-static int const FontColorCount = 8;
+// Colors in one palette bank. Cell colors below this pick from the first bank.
+static int const FontColorCount    = 8;
+static int const PaletteBankCount  = 4;
+static int const PaletteColorCount = FontColorCount * PaletteBankCount;
+static int const PaletteCycleCount = 4;
+
+// A cell color that lets the layers below show through. See AsciiLayer.
+static unsigned char const TransparentColor = 0xFF;
+
+// The cell color for color in the given palette bank.
+constexpr unsigned char GetBankColor(int bank, int color) {
+  return (unsigned char)(bank * FontColorCount + color);
+}
+
+// Rotates the palette entries [first, first + count) one slot every stepMs, so cells using them
+// animate without being rewritten. Smooth cycles blend toward the next entry between steps.
+struct PaletteCycle {
+  bool operator ==(PaletteCycle const &) const = default;
+
+  int  first    = 0;
+  int  count    = 0;
+  int  stepMs   = 0;
+  bool isSmooth = false;
+};
 
 struct AsciiFont {
   AsciiFont(void) = default;
 
   bool operator ==(AsciiFont const &) const = default;
 
-  ivec2 size;
-  Color colors[FontColorCount];
+  ivec2        size;
+  Color        colors[PaletteColorCount];
+  PaletteCycle cycles[PaletteCycleCount];
 };
 
 struct AsciiCell {
@@ -50,6 +80,72 @@ struct AsciiCell {
   unsigned char backgroundColor;
 };
 
+// Glyphs and colors an AsciiPackedCell can index. The glyph atlas holds its glyphs in pages of 256,
+// so glyphs past the first page are only reachable through packed cells.
+static int const PackedGlyphCount       = 1 << 10;
+static int const PackedColorCount       = 1 << 11;
+static int const PackedTransparentColor = PackedColorCount - 1;
+
+// A cell in one aligned 32 bit word: a 10 bit glyph index, then 11 bit foreground and background
+// colors. Windows upload these exactly as stored and unpack them on the GPU. Colors wrap around the
+// palette like AsciiCell's, and PackedTransparentColor stands in for TransparentColor.
+struct alignas(4) AsciiPackedCell {
+  AsciiPackedCell(void) : AsciiPackedCell(' ', 0, 0) {}
+
+  AsciiPackedCell(
+    int glyph,
+    int foregroundColor,
+    int backgroundColor
+  ) :
+    bits(
+      (uint32_t(glyph)           & 0x3FF)         |
+      ((uint32_t(foregroundColor) & 0x7FF) << 10) |
+      ((uint32_t(backgroundColor) & 0x7FF) << 21)
+    )
+  {}
+
+  bool operator ==(AsciiPackedCell const &) const = default;
+
+  int GetGlyph(void) const {
+    return int(bits & 0x3FF);
+  }
+
+  int GetForegroundColor(void) const {
+    return int((bits >> 10) & 0x7FF);
+  }
+
+  int GetBackgroundColor(void) const {
+    return int(bits >> 21);
+  }
+
+  uint32_t bits;
+};
+static_assert(sizeof(AsciiPackedCell) == 4);
+
+// One of the grids DrawLayers stacks, placed with its top left cell at offset. Where a cell's
+// background is TransparentColor the layers below show around its glyph, and where its foreground
+// is the glyph itself is cut out of the background. Cells outside the window are clipped. The
+// layer's colors are shifted paletteBank banks along the palette, so the same cells can be drawn
+// with another bank's colors.
+struct AsciiLayer {
+  AsciiLayer(void) = default;
+  AsciiLayer(Grid<AsciiCell, 2> const & cells) :
+    AsciiLayer(cells, ivec2(0, 0))
+  {}
+  AsciiLayer(Grid<AsciiCell, 2> const & cells, ivec2 const & offset) :
+    AsciiLayer(cells, offset, 0)
+  {}
+  AsciiLayer(Grid<AsciiCell, 2> const & cells, ivec2 const & offset, int paletteBank) :
+    cells(&cells),
+    offset(offset),
+    paletteBank(paletteBank)
+  {}
+
+  Grid<AsciiCell, 2> const * cells       = nullptr;
+  ivec2                      offset;
+  int                        paletteBank = 0;
+};
+
 enum class AsciiButton {
   Invalid = -1,
   Mouse1, MouseBegin = Mouse1,
@@ -176,6 +272,7 @@ enum class AsciiInputType {
   MousePosition,
   MouseScroll,
   State,
+  Resize,
 };
 
 struct AsciiInputEvent {
@@ -197,17 +294,65 @@ struct AsciiInputEvent {
       AsciiState state;
       bool       isActive;
     } stateEvent;
+    ivec2 resizeEvent;
   };
 };
 
+enum class AsciiRenderMode {
+  GeometryShader,
+  InstancedQuads,
+  CellTexture,
+};
+
+enum class AsciiThreadMode {
+  CallerThread,
+  RenderThread,
+};
+
+enum class AsciiStreamMode {
+  BufferUpdate,
+  PersistentRing,
+};
+
+// A frame read back from the window. Pixels are rows from the top, each left to right. frameIndex
+// counts frames drawn since capture started, so frames that were dropped leave gaps.
+struct AsciiCapturedFrame {
+  ivec2                  size;
+  int64_t                frameIndex = 0;
+  int64_t                runNs      = 0;
+  std::span<Color const> pixels;
+};
+
+// The frame's pixels are only valid during the call.
+using AsciiCaptureCallback = std::function<void(AsciiCapturedFrame const &)>;
+
 class IAsciiWindow {
 public:
   virtual ~IAsciiWindow(void) = default;
 
   virtual void Draw(Grid<AsciiCell, 2> const & draw) = 0;
 
+  // Draws layers bottom to top into a window of size cells. Each layer is diffed against what it
+  // held last frame, so a layer that didn't change costs no upload. Anything no layer covers is
+  // color 0.
+  virtual void DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) = 0;
+
+  // Draws cells in the 32 bit format, which can use glyphs on every page of the glyph atlas.
+  // Windows that only handle AsciiCell draw what UnpackCell makes of them.
+  virtual void DrawPacked(Grid<AsciiPackedCell, 2> const & draw) = 0;
+
+  // A grid the size of the window in cells to draw the next frame into and pass to Draw. It's kept
+  // by the window and reused from frame to frame, so drawing this way allocates nothing until the
+  // window is resized. A Resize input event says when that happens, and the next call returns a
+  // cleared grid of the new size. The reference is only valid until the next call.
+  virtual Grid<AsciiCell, 2> & AcquireBackbuffer(void) = 0;
+
   virtual std::vector<AsciiInputEvent> PollInput(void) = 0;
 
+  // Same events as PollInput without allocating. The span is only valid until the next
+  // PollInput or DrainInput call.
+  virtual std::span<AsciiInputEvent const> DrainInput(void) = 0;
+
   virtual std::string GetClipboard(void) const = 0;
   virtual void SetClipboard(std::string const & clipboard) = 0;
 
@@ -219,17 +364,39 @@ public:
 
   virtual int GetRunMs(void) const = 0;
   virtual void Sleep(int milliseconds) = 0;
+
+  virtual int64_t GetRunUs(void) const = 0;
+  virtual int64_t GetRunNs(void) const = 0;
+
+  // Returns as close to runNs as the platform allows, rather than whenever the OS wakes us.
+  virtual void SleepUntilNs(int64_t runNs) = 0;
+
+  // Stats for the frames drawn so far, always recorded. Only read them from the thread that draws.
+  virtual FrameStatsRecorder const & GetFrameStats(void) const = 0;
 };
 
 class AsciiWindow : public IAsciiWindow {
 public:
   AsciiWindow(void);
+  AsciiWindow(AsciiRenderMode renderMode);
+
+  // With RenderThread, Draw hands the grid to a thread that owns the GL context and returns
+  // without waiting for the upload or buffer swap. Only the newest grid is drawn if the caller
+  // submits faster than the renderer keeps up.
+  AsciiWindow(AsciiRenderMode renderMode, AsciiThreadMode threadMode);
 
   virtual ~AsciiWindow(void) override = default;
 
   virtual void Draw(Grid<AsciiCell, 2> const & draw) override;
+  virtual void DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) override;
+
+  // Packed cells are copied to the GPU as they are, without being converted first.
+  virtual void DrawPacked(Grid<AsciiPackedCell, 2> const & draw) override;
+
+  virtual Grid<AsciiCell, 2> & AcquireBackbuffer(void) override;
 
   virtual std::vector<AsciiInputEvent> PollInput(void) override;
+  virtual std::span<AsciiInputEvent const> DrainInput(void) override;
 
   virtual std::string GetClipboard(void) const override;
   virtual void SetClipboard(std::string const & clipboard) override;
@@ -243,10 +410,55 @@ public:
   virtual int GetRunMs(void) const override;
   virtual void Sleep(int milliseconds) override;
 
+  virtual int64_t GetRunUs(void) const override;
+  virtual int64_t GetRunNs(void) const override;
+  virtual void SleepUntilNs(int64_t runNs) override;
+
+  // With RenderThread, draw time is how long the frame took to hand over. Swap time and uploaded
+  // cells are those of the last frame the render thread finished.
+  virtual FrameStatsRecorder const & GetFrameStats(void) const override;
+
+  // Records the time between consecutive Draw calls while enabled.
+  void SetFrameTimeMeasurement(bool isEnabled);
+  FrameTimeRecorder const & GetFrameTimes(void) const;
+
+  int GetUploadedBytes(void) const;
+
+  // GL calls made during the last Draw.
+  int GetGlCallCount(void) const;
+
+  AsciiRenderMode GetRenderMode(void) const;
+  AsciiThreadMode GetThreadMode(void) const;
+
+  // PersistentRing falls back to BufferUpdate when buffer storage isn't supported or the
+  // render mode is CellTexture.
+  AsciiStreamMode GetStreamMode(void) const;
+  void SetStreamMode(AsciiStreamMode mode);
+
+  // Reads back every drawn frame without stalling on the GPU. Frames are copied into pixel buffers
+  // and handed to callback a few frames later, on whichever thread renders. If the GPU falls so far
+  // behind that every buffer is still in flight, the frame is dropped rather than waited for.
+  void StartCapture(AsciiCaptureCallback const & callback);
+
+  // Writes captured frames to output as a stream of binary PPM images.
+  void StartCapture(std::shared_ptr<std::ostream> const & output);
+
+  // Frames still in flight are delivered before this returns, so the callback is never called after.
+  void StopCapture(void);
+  bool IsCapturing(void) const;
+
+  int GetDroppedCaptureFrames(void) const;
+
 private:
   struct Impl;
 
-  int GetCurrentMs(void) const;
+  static int64_t GetCurrentNs(void);
+
+  // Measures the frame and resizes the window for it. Returns when the frame was drawn.
+  int64_t BeginDraw(ivec2 const & size);
+
+  // Adds the draw that started at drawStartNs to the frame stats and ends the frame.
+  void EndDraw(int64_t drawStartNs);
 
   std::shared_ptr<Impl> m_impl;
 };
@@ -260,12 +472,39 @@ public:                                       \
     ((Grid<AsciiCell, 2> const & draw)),      \
     (override)                                \
   );                                          \
+  MOCK_METHOD(                                \
+    void,                                     \
+    DrawLayers,                               \
+    (                                         \
+      ivec2 const &,                          \
+      std::span<AsciiLayer const>             \
+    ),                                        \
+    (override)                                \
+  );                                          \
+  MOCK_METHOD(                                \
+    void,                                     \
+    DrawPacked,                               \
+    ((Grid<AsciiPackedCell, 2> const &)),     \
+    (override)                                \
+  );                                          \
+  MOCK_METHOD(                                \
+    (Grid<AsciiCell, 2> &),                   \
+    AcquireBackbuffer,                        \
+    (),                                       \
+    (override)                                \
+  );                                          \
   MOCK_METHOD(                                \
     std::vector<AsciiInputEvent>,             \
     PollInput,                                \
     (),                                       \
     (override)                                \
   );                                          \
+  MOCK_METHOD(                                \
+    std::span<AsciiInputEvent const>,         \
+    DrainInput,                               \
+    (),                                       \
+    (override)                                \
+  );                                          \
   MOCK_METHOD(                                \
     std::string,                              \
     GetClipboard,                             \
@@ -314,6 +553,30 @@ public:                                       \
     (int),                                    \
     (override)                                \
   );                                          \
+  MOCK_METHOD(                                \
+    int64_t,                                  \
+    GetRunUs,                                 \
+    (),                                       \
+    (const, override)                         \
+  );                                          \
+  MOCK_METHOD(                                \
+    int64_t,                                  \
+    GetRunNs,                                 \
+    (),                                       \
+    (const, override)                         \
+  );                                          \
+  MOCK_METHOD(                                \
+    void,                                     \
+    SleepUntilNs,                             \
+    (int64_t),                                \
+    (override)                                \
+  );                                          \
+  MOCK_METHOD(                                \
+    FrameStatsRecorder const &,               \
+    GetFrameStats,                            \
+    (),                                       \
+    (const, override)                         \
+  );                                          \
 }
 
 
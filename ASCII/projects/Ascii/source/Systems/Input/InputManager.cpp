@@ -42,9 +42,7 @@ void InputManager::ProcessInput(void) {
     return;
   }
 
-  std::vector<AsciiInputEvent> events = m_window->PollInput();
-
-  for (auto const & event : events) {
+  for (auto const & event : m_window->DrainInput()) {
     switch (event.type) {
       case AsciiInputType::Button: {
         if (m_buttonManager) {
@@ -78,6 +76,9 @@ void InputManager::ProcessInput(void) {
           );
         }
       } break;
+
+      default: {
+      } break;
     }
   }
 }
@@ -0,0 +1,322 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/AnsiEncoder.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace {
+  // Unicode code points for the block font's glyphs, in code page 437 order.
+  uint16_t const c_codePage437[256] = {
+    0x0020, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022,
+    0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C,
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8,
+    0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302,
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x0020,
+  };
+
+  struct GlyphTextTable {
+    GlyphTextTable(void) {
+      for (int i = 0; i < 256; ++i) {
+        uint16_t const codePoint = c_codePage437[i];
+        char *         write     = text[i];
+
+        if (codePoint < 0x80) {
+          *write++ = char(codePoint);
+        }
+        else if (codePoint < 0x800) {
+          *write++ = char(0xC0 | (codePoint >> 6));
+          *write++ = char(0x80 | (codePoint & 0x3F));
+        }
+        else {
+          *write++ = char(0xE0 | (codePoint >> 12));
+          *write++ = char(0x80 | ((codePoint >> 6) & 0x3F));
+          *write++ = char(0x80 | (codePoint & 0x3F));
+        }
+
+        *write = '\0';
+        length[i] = int(write - text[i]);
+      }
+    }
+
+    char text[256][4];
+    int  length[256];
+  };
+
+  GlyphTextTable const s_glyphText;
+
+  // Past this many cells a cursor sequence is always shorter than rewriting the cells.
+  int const c_maxRewriteCells = 8;
+
+  unsigned char const c_fullBlock = 219;
+
+  bool IsBlankGlyph(char character) {
+    unsigned char const value = (unsigned char)(character);
+    return value == 0 || value == ' ' || value == 255;
+  }
+
+  bool IsSolidGlyph(char character) {
+    return (unsigned char)(character) == c_fullBlock;
+  }
+
+  // A terminal has nothing under a frame to show through, so transparent cells get color 0 like
+  // the GL window's clear color. Other colors past the palette wrap, as they do when packed.
+  int GetPaletteIndex(unsigned char color) {
+    return color == TransparentColor ? 0 : color % PaletteColorCount;
+  }
+
+  void AppendNumber(int value, std::string & io_output) {
+    char       buffer[16];
+    auto const result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    io_output.append(buffer, result.ptr);
+  }
+
+  int CountDigits(int value) {
+    int digits = 1;
+    for (; value >= 10; value /= 10) {
+      ++digits;
+    }
+    return digits;
+  }
+}
+
+AnsiFrameEncoder::AnsiFrameEncoder(void) {
+  for (int i = 0; i < PaletteColorCount; ++i) {
+    BuildColorCodes(i);
+  }
+}
+
+void AnsiFrameEncoder::SetPalette(Color const * colors) {
+  for (int i = 0; i < PaletteColorCount; ++i) {
+    if (colors[i] == m_palette[i]) {
+      continue;
+    }
+
+    m_palette[i]       = colors[i];
+    m_changedColors[i] = true;
+    m_hasChangedColors = true;
+
+    BuildColorCodes(i);
+
+    // The terminal's current colors are the old ones, so they have to be sent again.
+    if (i == m_foreground) {
+      m_foreground = -1;
+    }
+    if (i == m_background) {
+      m_background = -1;
+    }
+  }
+}
+
+void AnsiFrameEncoder::BuildColorCodes(int index) {
+  Color const & color = m_palette[index];
+
+  for (int layer = 0; layer < 2; ++layer) {
+    std::string & code = m_colorCodes[layer][index];
+
+    code = layer == 0 ? "38;2;" : "48;2;";
+    AppendNumber(color.r, code);
+    code += ';';
+    AppendNumber(color.g, code);
+    code += ';';
+    AppendNumber(color.b, code);
+  }
+}
+
+void AnsiFrameEncoder::Invalidate(void) {
+  m_isValid = false;
+}
+
+void AnsiFrameEncoder::Encode(Grid<AsciiCell, 2> const & draw, std::string & io_output) {
+  bool const isFullFrame = !m_isValid || m_previous.GetSize() != draw.GetSize();
+
+  if (isFullFrame) {
+    io_output += "\x1b[0m\x1b[2J";
+
+    m_isCursorKnown = false;
+    m_foreground    = -1;
+    m_background    = -1;
+  }
+
+  m_writtenCells = 0;
+
+  ivec2 const             size     = draw.GetSize();
+  AsciiCell const * const cells    = draw.Data();
+  AsciiCell const * const previous = m_previous.Data();
+
+  for (int y = 0; y < size.y; ++y) {
+    for (int x = 0; x < size.x; ++x) {
+      int const index = y * size.x + x;
+
+      if (!isFullFrame && cells[index] == previous[index] && !IsRecolored(previous[index])) {
+        continue;
+      }
+
+      MoveCursor(draw, ivec2(x, y), io_output);
+      SetColors(cells[index], io_output);
+      WriteCell(cells[index], io_output);
+
+      // At the last column the terminal holds the cursor in a pending wrap state that differs
+      // between terminals, so it has to be placed explicitly next time.
+      if (m_cursor.x == size.x) {
+        m_isCursorKnown = false;
+      }
+    }
+  }
+
+  m_previous = draw;
+  m_isValid  = true;
+
+  if (m_hasChangedColors) {
+    std::fill(std::begin(m_changedColors), std::end(m_changedColors), false);
+    m_hasChangedColors = false;
+  }
+}
+
+int AnsiFrameEncoder::GetWrittenCells(void) const {
+  return m_writtenCells;
+}
+
+void AnsiFrameEncoder::MoveCursor(Grid<AsciiCell, 2> const & draw, ivec2 const & target, std::string & io_output) {
+  if (m_isCursorKnown && m_cursor == target) {
+    return;
+  }
+
+  if (m_isCursorKnown && m_cursor.y == target.y && m_cursor.x < target.x) {
+    int const gap          = target.x - m_cursor.x;
+    int const forwardBytes = gap == 1 ? 3 : 3 + CountDigits(gap);
+
+    if (gap <= c_maxRewriteCells) {
+      AsciiCell const * const row          = draw.Data() + target.y * draw.GetSize().x;
+      int                     rewriteBytes = 0;
+      bool                    canRewrite   = true;
+
+      for (int x = m_cursor.x; x < target.x && canRewrite; ++x) {
+        canRewrite    = CanRewriteCell(row[x]);
+        rewriteBytes += s_glyphText.length[(unsigned char)(row[x].character)];
+      }
+
+      if (canRewrite && rewriteBytes <= forwardBytes) {
+        for (int x = m_cursor.x; x < target.x; ++x) {
+          WriteCell(row[x], io_output);
+        }
+        return;
+      }
+    }
+
+    io_output += "\x1b[";
+    if (gap > 1) {
+      AppendNumber(gap, io_output);
+    }
+    io_output += 'C';
+  }
+  else if (m_isCursorKnown && target.x == 0 && target.y == m_cursor.y) {
+    io_output += '\r';
+  }
+  else if (m_isCursorKnown && target.x == 0 && target.y == m_cursor.y + 1) {
+    io_output += "\r\n";
+  }
+  else {
+    io_output += "\x1b[";
+    if (target != ivec2(0, 0)) {
+      AppendNumber(target.y + 1, io_output);
+      if (target.x != 0) {
+        io_output += ';';
+        AppendNumber(target.x + 1, io_output);
+      }
+    }
+    io_output += 'H';
+  }
+
+  m_cursor        = target;
+  m_isCursorKnown = true;
+}
+
+void AnsiFrameEncoder::SetColors(AsciiCell const & cell, std::string & io_output) {
+  int const  foreground    = GetPaletteIndex(cell.foregroundColor);
+  int const  background    = GetPaletteIndex(cell.backgroundColor);
+  bool const setForeground = !IsBlankGlyph(cell.character) && foreground != m_foreground;
+  bool const setBackground = !IsSolidGlyph(cell.character) && background != m_background;
+
+  if (!setForeground && !setBackground) {
+    return;
+  }
+
+  io_output += "\x1b[";
+
+  if (setForeground) {
+    io_output    += m_colorCodes[0][foreground];
+    m_foreground  = foreground;
+  }
+
+  if (setBackground) {
+    if (setForeground) {
+      io_output += ';';
+    }
+
+    io_output    += m_colorCodes[1][background];
+    m_background  = background;
+  }
+
+  io_output += 'm';
+}
+
+void AnsiFrameEncoder::WriteCell(AsciiCell const & cell, std::string & io_output) {
+  unsigned char const character = (unsigned char)(cell.character);
+
+  io_output.append(s_glyphText.text[character], s_glyphText.length[character]);
+  ++m_cursor.x;
+  ++m_writtenCells;
+}
+
+bool AnsiFrameEncoder::CanRewriteCell(AsciiCell const & cell) const {
+  bool const hasForeground = IsBlankGlyph(cell.character) || GetPaletteIndex(cell.foregroundColor) == m_foreground;
+  bool const hasBackground = IsSolidGlyph(cell.character) || GetPaletteIndex(cell.backgroundColor) == m_background;
+
+  return hasForeground && hasBackground;
+}
+
+bool AnsiFrameEncoder::IsRecolored(AsciiCell const & cell) const {
+  if (!m_hasChangedColors) {
+    return false;
+  }
+
+  bool const isForegroundChanged = !IsBlankGlyph(cell.character) && m_changedColors[GetPaletteIndex(cell.foregroundColor)];
+  bool const isBackgroundChanged = !IsSolidGlyph(cell.character) && m_changedColors[GetPaletteIndex(cell.backgroundColor)];
+
+  return isForegroundChanged || isBackgroundChanged;
+}
+
+char const * GetAnsiGlyphText(unsigned char character) {
+  return s_glyphText.text[character];
+}
@@ -0,0 +1,380 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/AnsiInput.h"
+
+#include <algorithm>
+
+namespace {
+  char const c_escape = '\x1b';
+
+  // Anything longer is not a sequence we understand, so it is dropped rather than held forever.
+  int const c_maxSequenceSize = 32;
+
+  // Parameters stop growing here, so a run of digits can't overflow. No key or cell position
+  // terminals report comes near it.
+  int const c_maxParameter = 9999;
+
+  // Modifier bits as terminals report them, one less than the number in the sequence.
+  int const c_modifierShift   = 0x1;
+  int const c_modifierAlt     = 0x2;
+  int const c_modifierControl = 0x4;
+
+  int const c_mouseButtonMask = 0x03;
+  int const c_mouseMotionBit  = 0x20;
+  int const c_mouseWheelBit   = 0x40;
+
+  void AppendState(AsciiState state, bool isActive, std::vector<AsciiInputEvent> & io_events) {
+    AsciiInputEvent event;
+
+    event.type                = AsciiInputType::State;
+    event.stateEvent.state    = state;
+    event.stateEvent.isActive = isActive;
+
+    io_events.push_back(event);
+  }
+
+  void AppendButton(AsciiButton button, bool isDown, std::vector<AsciiInputEvent> & io_events) {
+    AsciiInputEvent event;
+
+    event.type               = AsciiInputType::Button;
+    event.buttonEvent.button = button;
+    event.buttonEvent.isDown = isDown;
+
+    io_events.push_back(event);
+  }
+
+  void AppendKeyPress(AsciiButton button, int modifiers, std::vector<AsciiInputEvent> & io_events) {
+    AsciiState const states[] = { AsciiState::Shift, AsciiState::Alt, AsciiState::Control };
+    int const        bits[]   = { c_modifierShift,   c_modifierAlt,   c_modifierControl   };
+
+    for (int i = 0; i < 3; ++i) {
+      if (modifiers & bits[i]) {
+        AppendState(states[i], true, io_events);
+      }
+    }
+
+    AppendButton(button, true, io_events);
+    AppendButton(button, false, io_events);
+
+    for (int i = 2; i >= 0; --i) {
+      if (modifiers & bits[i]) {
+        AppendState(states[i], false, io_events);
+      }
+    }
+  }
+
+  // Maps what a US keyboard sends for a single byte back to the key and modifiers that produced it.
+  bool GetButtonFromCharacter(char character, AsciiButton & o_button, int & o_modifiers) {
+    o_modifiers = 0;
+
+    if (character >= 'a' && character <= 'z') {
+      o_button = AsciiButton(int(AsciiButton::A) + (character - 'a'));
+      return true;
+    }
+
+    if (character >= 'A' && character <= 'Z') {
+      o_button    = AsciiButton(int(AsciiButton::A) + (character - 'A'));
+      o_modifiers = c_modifierShift;
+      return true;
+    }
+
+    if (character >= '1' && character <= '9') {
+      o_button = AsciiButton(int(AsciiButton::Key1) + (character - '1'));
+      return true;
+    }
+
+    switch (character) {
+      case '0':    o_button = AsciiButton::Key0;                                            return true;
+      case ' ':    o_button = AsciiButton::Space;                                           return true;
+      case '\r':   o_button = AsciiButton::Return;                                          return true;
+      case '\n':   o_button = AsciiButton::Return;                                          return true;
+      case '\t':   o_button = AsciiButton::Tab;                                             return true;
+      case '\b':   o_button = AsciiButton::Backspace;                                       return true;
+      case '\x7f': o_button = AsciiButton::Backspace;                                       return true;
+      case '\x00': o_button = AsciiButton::Space;        o_modifiers = c_modifierControl;   return true;
+      case '`':    o_button = AsciiButton::Grave;                                           return true;
+      case '~':    o_button = AsciiButton::Grave;        o_modifiers = c_modifierShift;     return true;
+      case '!':    o_button = AsciiButton::Key1;         o_modifiers = c_modifierShift;     return true;
+      case '@':    o_button = AsciiButton::Key2;         o_modifiers = c_modifierShift;     return true;
+      case '#':    o_button = AsciiButton::Key3;         o_modifiers = c_modifierShift;     return true;
+      case '$':    o_button = AsciiButton::Key4;         o_modifiers = c_modifierShift;     return true;
+      case '%':    o_button = AsciiButton::Key5;         o_modifiers = c_modifierShift;     return true;
+      case '^':    o_button = AsciiButton::Key6;         o_modifiers = c_modifierShift;     return true;
+      case '&':    o_button = AsciiButton::Key7;         o_modifiers = c_modifierShift;     return true;
+      case '*':    o_button = AsciiButton::Key8;         o_modifiers = c_modifierShift;     return true;
+      case '(':    o_button = AsciiButton::Key9;         o_modifiers = c_modifierShift;     return true;
+      case ')':    o_button = AsciiButton::Key0;         o_modifiers = c_modifierShift;     return true;
+      case '-':    o_button = AsciiButton::Dash;                                            return true;
+      case '_':    o_button = AsciiButton::Dash;         o_modifiers = c_modifierShift;     return true;
+      case '=':    o_button = AsciiButton::Equal;                                           return true;
+      case '+':    o_button = AsciiButton::Equal;        o_modifiers = c_modifierShift;     return true;
+      case '[':    o_button = AsciiButton::LeftBracket;                                     return true;
+      case '{':    o_button = AsciiButton::LeftBracket;  o_modifiers = c_modifierShift;     return true;
+      case ']':    o_button = AsciiButton::RightBracket;                                    return true;
+      case '}':    o_button = AsciiButton::RightBracket; o_modifiers = c_modifierShift;     return true;
+      case '\\':   o_button = AsciiButton::BackSlash;                                       return true;
+      case '|':    o_button = AsciiButton::BackSlash;    o_modifiers = c_modifierShift;     return true;
+      case ';':    o_button = AsciiButton::Semicolon;                                       return true;
+      case ':':    o_button = AsciiButton::Semicolon;    o_modifiers = c_modifierShift;     return true;
+      case '\'':   o_button = AsciiButton::Apostrophe;                                      return true;
+      case '"':    o_button = AsciiButton::Apostrophe;   o_modifiers = c_modifierShift;     return true;
+      case ',':    o_button = AsciiButton::Comma;                                           return true;
+      case '<':    o_button = AsciiButton::Comma;        o_modifiers = c_modifierShift;     return true;
+      case '.':    o_button = AsciiButton::Period;                                          return true;
+      case '>':    o_button = AsciiButton::Period;       o_modifiers = c_modifierShift;     return true;
+      case '/':    o_button = AsciiButton::ForwardSlash;                                    return true;
+      case '?':    o_button = AsciiButton::ForwardSlash; o_modifiers = c_modifierShift;     return true;
+      default:     break;
+    }
+
+    // The remaining control bytes are control held with a letter.
+    if (character >= '\x01' && character <= '\x1a') {
+      o_button    = AsciiButton(int(AsciiButton::A) + (character - '\x01'));
+      o_modifiers = c_modifierControl;
+      return true;
+    }
+
+    return false;
+  }
+
+  // The key for the final byte of an "ESC [" or "ESC O" sequence without a number.
+  AsciiButton GetButtonFromFinal(char final) {
+    switch (final) {
+      case 'A': return AsciiButton::Up;
+      case 'B': return AsciiButton::Down;
+      case 'C': return AsciiButton::Right;
+      case 'D': return AsciiButton::Left;
+      case 'H': return AsciiButton::Home;
+      case 'F': return AsciiButton::End;
+      case 'P': return AsciiButton::F1;
+      case 'Q': return AsciiButton::F2;
+      case 'R': return AsciiButton::F3;
+      case 'S': return AsciiButton::F4;
+      default:  return AsciiButton::Invalid;
+    }
+  }
+
+  // The key for the number of an "ESC [ number ~" sequence.
+  AsciiButton GetButtonFromTildeCode(int code) {
+    switch (code) {
+      case 1:  return AsciiButton::Home;
+      case 2:  return AsciiButton::Insert;
+      case 3:  return AsciiButton::Delete;
+      case 4:  return AsciiButton::End;
+      case 5:  return AsciiButton::PageUp;
+      case 6:  return AsciiButton::PageDown;
+      case 7:  return AsciiButton::Home;
+      case 8:  return AsciiButton::End;
+      case 11: return AsciiButton::F1;
+      case 12: return AsciiButton::F2;
+      case 13: return AsciiButton::F3;
+      case 14: return AsciiButton::F4;
+      case 15: return AsciiButton::F5;
+      case 17: return AsciiButton::F6;
+      case 18: return AsciiButton::F7;
+      case 19: return AsciiButton::F8;
+      case 20: return AsciiButton::F9;
+      case 21: return AsciiButton::F10;
+      case 23: return AsciiButton::F11;
+      case 24: return AsciiButton::F12;
+      default: return AsciiButton::Invalid;
+    }
+  }
+
+  // Reads the numbers separated by ';' in parameters. Missing numbers are 0, and larger ones than
+  // c_maxParameter are c_maxParameter.
+  int ReadParameters(std::string const & parameters, int * o_values, int maxCount) {
+    int count = 0;
+    int value = 0;
+
+    for (char character : parameters) {
+      if (character >= '0' && character <= '9') {
+        value = std::min(value * 10 + (character - '0'), c_maxParameter);
+      }
+      else if (character == ';') {
+        if (count < maxCount) {
+          o_values[count++] = value;
+        }
+        value = 0;
+      }
+    }
+
+    if (count < maxCount) {
+      o_values[count++] = value;
+    }
+
+    return count;
+  }
+
+  // Terminals add one to the modifier bits so an unmodified key can be sent as 1 or left out.
+  int GetModifiers(int const * values, int count) {
+    return count > 1 && values[1] > 0 ? values[1] - 1 : 0;
+  }
+}
+
+void AnsiInputParser::Parse(char const * bytes, int count, std::vector<AsciiInputEvent> & io_events) {
+  m_pending.append(bytes, count);
+
+  int read = 0;
+
+  while (read < int(m_pending.size())) {
+    char const character = m_pending[read];
+
+    if (character == c_escape) {
+      int const consumed = ParseEscape(read, io_events);
+
+      if (consumed == 0) {
+        break;
+      }
+
+      read += consumed;
+      continue;
+    }
+
+    AsciiButton button;
+    int         modifiers;
+
+    if (GetButtonFromCharacter(character, button, modifiers)) {
+      AppendKeyPress(button, modifiers, io_events);
+    }
+
+    ++read;
+  }
+
+  m_pending.erase(0, read);
+}
+
+void AnsiInputParser::Flush(std::vector<AsciiInputEvent> & io_events) {
+  if (m_pending.size() == 1 && m_pending[0] == c_escape) {
+    AppendKeyPress(AsciiButton::Escape, 0, io_events);
+  }
+
+  m_pending.clear();
+}
+
+int AnsiInputParser::ParseEscape(int begin, std::vector<AsciiInputEvent> & io_events) {
+  int const available = int(m_pending.size()) - begin;
+
+  if (available < 2) {
+    return 0;
+  }
+
+  char const introducer = m_pending[begin + 1];
+
+  // Escape pressed twice.
+  if (introducer == c_escape) {
+    AppendKeyPress(AsciiButton::Escape, 0, io_events);
+    return 1;
+  }
+
+  if (introducer == 'O') {
+    if (available < 3) {
+      return 0;
+    }
+
+    AsciiButton const button = GetButtonFromFinal(m_pending[begin + 2]);
+    if (button != AsciiButton::Invalid) {
+      AppendKeyPress(button, 0, io_events);
+    }
+    return 3;
+  }
+
+  if (introducer != '[') {
+    AsciiButton button;
+    int         modifiers;
+
+    if (GetButtonFromCharacter(introducer, button, modifiers)) {
+      AppendKeyPress(button, modifiers | c_modifierAlt, io_events);
+    }
+    return 2;
+  }
+
+  // Parameter bytes run until a final byte in '@' to '~'.
+  int end = begin + 2;
+  while (end < int(m_pending.size()) && (m_pending[end] < '@' || m_pending[end] > '~')) {
+    ++end;
+  }
+
+  if (end == int(m_pending.size())) {
+    return available < c_maxSequenceSize ? 0 : available;
+  }
+
+  std::string const parameters = m_pending.substr(begin + 2, end - begin - 2);
+  char const        final      = m_pending[end];
+  int const         consumed   = end - begin + 1;
+
+  if (!parameters.empty() && parameters[0] == '<') {
+    if (final == 'M' || final == 'm') {
+      ParseMouse(parameters, final == 'm', io_events);
+    }
+    return consumed;
+  }
+
+  int       values[4] = { 0 };
+  int const count     = ReadParameters(parameters, values, 4);
+  int const modifiers = GetModifiers(values, count);
+
+  AsciiButton button = AsciiButton::Invalid;
+  int         extra  = 0;
+
+  if (final == '~') {
+    button = GetButtonFromTildeCode(values[0]);
+  }
+  else if (final == 'Z') {
+    button = AsciiButton::Tab;
+    extra  = c_modifierShift;
+  }
+  else {
+    button = GetButtonFromFinal(final);
+  }
+
+  if (button != AsciiButton::Invalid) {
+    AppendKeyPress(button, modifiers | extra, io_events);
+  }
+
+  return consumed;
+}
+
+void AnsiInputParser::ParseMouse(std::string const & parameters, bool isRelease, std::vector<AsciiInputEvent> & io_events) {
+  int values[3] = { 0 };
+
+  if (ReadParameters(parameters, values, 3) != 3) {
+    return;
+  }
+
+  int const   code     = values[0];
+  ivec2 const position = ivec2(values[1] - 1, values[2] - 1);
+
+  if (position != m_mousePosition) {
+    AsciiInputEvent event;
+
+    event.type               = AsciiInputType::MousePosition;
+    event.mousePositionEvent = position;
+
+    io_events.push_back(event);
+    m_mousePosition = position;
+  }
+
+  if (code & c_mouseWheelBit) {
+    AsciiInputEvent event;
+
+    event.type             = AsciiInputType::MouseScroll;
+    event.mouseScrollEvent = (code & c_mouseButtonMask) == 0 ? 1 : -1;
+
+    io_events.push_back(event);
+    return;
+  }
+
+  if (code & c_mouseMotionBit) {
+    return;
+  }
+
+  AsciiButton const buttons[] = { AsciiButton::Mouse1, AsciiButton::Mouse3, AsciiButton::Mouse2 };
+  int const         button    = code & c_mouseButtonMask;
+
+  if (button < 3) {
+    AppendButton(buttons[button], !isRelease, io_events);
+  }
+}
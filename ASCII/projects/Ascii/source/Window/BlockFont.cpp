@@ -4,6 +4,8 @@
 
 #include "Window/BlockFont.h"
 
+#include "Window/GlyphAtlas.h"
+
 namespace {
   // Generated to contain glyph data.
   static unsigned char const s_glyphs[256][144] = {
@@ -1689,16 +1691,16 @@ namespace {
   static bool          s_glyphSheetInitialized                          = false;
 
   unsigned char const * GetGlyphForChar(char character) {
-    return s_glyphs[character];
+    return s_glyphs[(unsigned char)(character)];
   }
 }
 
-ivec2 GetGlyphSize(void) {
+ivec2 GetBlockFontGlyphSize(void) {
   return ivec2(c_glyphWidth, c_glyphHeight);
 }
 
 
-unsigned char const * GetGlyphSheet(void) {
+unsigned char const * GetBlockFontSheet(void) {
   if (!s_glyphSheetInitialized) {
     for (int i = 0; i < sizeof(s_glyphs) / sizeof(*s_glyphs); ++i) {
       int const glyphXPos  = i % c_glyphsPerRow;
@@ -1721,3 +1723,15 @@ unsigned char const * GetGlyphSheet(void) {
 
   return s_glyphSheet;
 }
+
+ivec2 GetGlyphSize(void) {
+  thread_local GlyphAtlasCache atlas;
+
+  return atlas.Get()->GetGlyphSize();
+}
+
+unsigned char const * GetGlyphSheet(void) {
+  thread_local GlyphAtlasCache atlas;
+
+  return atlas.Get()->GetGlyphSheet();
+}
@@ -0,0 +1,24 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/CaptureWriter.h"
+
+PpmCaptureWriter::PpmCaptureWriter(std::shared_ptr<std::ostream> const & output) :
+  m_output(output)
+{}
+
+void PpmCaptureWriter::Write(AsciiCapturedFrame const & frame) {
+  static_assert(sizeof(Color) == 3);
+
+  std::string const header = "P6\n" + std::to_string(frame.size.x) + " " + std::to_string(frame.size.y) + "\n255\n";
+
+  m_output->write(header.data(), std::streamsize(header.size()));
+  m_output->write(reinterpret_cast<char const *>(frame.pixels.data()), std::streamsize(frame.pixels.size_bytes()));
+
+  ++m_writtenFrames;
+}
+
+int64_t PpmCaptureWriter::GetWrittenFrames(void) const {
+  return m_writtenFrames;
+}
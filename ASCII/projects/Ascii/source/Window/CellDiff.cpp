@@ -0,0 +1,115 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/CellDiff.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define ASCII_CELLDIFF_USE_SSE2
+#endif
+
+namespace {
+  int const c_compareBlockCells = 32;
+
+  // Cells per SSE2 register, and registers checked together before looking at single cells.
+  int const c_packedLaneCells    = 4;
+  int const c_packedBlockVectors = 4;
+
+  void AddChangedCell(int index, int mergeDistance, std::vector<CellSpan> & io_spans) {
+    if (!io_spans.empty() && index - io_spans.back().end <= mergeDistance) {
+      io_spans.back().end = index + 1;
+    }
+    else {
+      io_spans.emplace_back(index, index + 1);
+    }
+  }
+}
+
+void FindChangedCellSpans(
+  AsciiCell const *       previous,
+  AsciiCell const *       current,
+  int                     count,
+  int                     mergeDistance,
+  std::vector<CellSpan> & o_spans
+) {
+  o_spans.clear();
+
+  int index = 0;
+  while (index < count) {
+    int const blockEnd = std::min(index + c_compareBlockCells, count);
+
+    // Most of the screen is usually unchanged, so skip whole blocks with a single compare first.
+    if (std::memcmp(previous + index, current + index, (blockEnd - index) * sizeof(AsciiCell)) == 0) {
+      index = blockEnd;
+      continue;
+    }
+
+    for (; index < blockEnd; ++index) {
+      if (!(previous[index] == current[index])) {
+        AddChangedCell(index, mergeDistance, o_spans);
+      }
+    }
+  }
+}
+
+void FindChangedCellSpans(
+  AsciiPackedCell const * previous,
+  AsciiPackedCell const * current,
+  int                     count,
+  int                     mergeDistance,
+  std::vector<CellSpan> & o_spans
+) {
+  o_spans.clear();
+
+  int index = 0;
+
+#ifdef ASCII_CELLDIFF_USE_SSE2
+  int const blockCells = c_packedLaneCells * c_packedBlockVectors;
+
+  for (; index + blockCells <= count; index += blockCells) {
+    int equalMasks[c_packedBlockVectors];
+    int allEqual = 0xF;
+
+    for (int vector = 0; vector < c_packedBlockVectors; ++vector) {
+      int const     offset = index + vector * c_packedLaneCells;
+      __m128i const before = _mm_loadu_si128(reinterpret_cast<__m128i const *>(previous + offset));
+      __m128i const after  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(current + offset));
+
+      equalMasks[vector]  = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(before, after)));
+      allEqual           &= equalMasks[vector];
+    }
+
+    if (allEqual == 0xF) {
+      continue;
+    }
+
+    for (int vector = 0; vector < c_packedBlockVectors; ++vector) {
+      for (int lane = 0; lane < c_packedLaneCells; ++lane) {
+        if (!(equalMasks[vector] & (1 << lane))) {
+          AddChangedCell(index + vector * c_packedLaneCells + lane, mergeDistance, o_spans);
+        }
+      }
+    }
+  }
+#endif
+
+  for (; index < count; ++index) {
+    if (previous[index].bits != current[index].bits) {
+      AddChangedCell(index, mergeDistance, o_spans);
+    }
+  }
+}
+
+int CountSpanCells(std::vector<CellSpan> const & spans) {
+  int result = 0;
+
+  for (CellSpan const & span : spans) {
+    result += span.Count();
+  }
+
+  return result;
+}
@@ -0,0 +1,301 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/FrameCodec.h"
+
+#include "Window/CellDiff.h"
+
+namespace {
+  // Restarting a span costs two varints, so short unchanged gaps are cheaper to store as cells.
+  int const c_spanMergeDistance = 2;
+
+  void WriteCell(AsciiCell const & cell, std::vector<unsigned char> & io_bytes) {
+    io_bytes.push_back((unsigned char)(cell.character));
+    io_bytes.push_back(cell.foregroundColor);
+    io_bytes.push_back(cell.backgroundColor);
+  }
+
+  bool ReadCell(unsigned char const * & io_read, unsigned char const * end, AsciiCell & o_cell) {
+    if (end - io_read < 3) {
+      return false;
+    }
+
+    o_cell = AsciiCell(char(io_read[0]), io_read[1], io_read[2]);
+
+    io_read += 3;
+    return true;
+  }
+
+  uint64_t ZigZag(int value) {
+    return (uint32_t(value) << 1) ^ uint32_t(value >> 31);
+  }
+
+  int UnZigZag(uint64_t value) {
+    return int(uint32_t(value >> 1) ^ -uint32_t(value & 1));
+  }
+
+  bool ReadVarInt(unsigned char const * & io_read, unsigned char const * end, int & o_value) {
+    uint64_t zigZagged = 0;
+    if (!ReadVarUint(io_read, end, zigZagged)) {
+      return false;
+    }
+
+    o_value = UnZigZag(zigZagged);
+    return true;
+  }
+}
+
+void WriteVarUint(uint64_t value, std::vector<unsigned char> & io_bytes) {
+  while (value >= 0x80) {
+    io_bytes.push_back((unsigned char)(value | 0x80));
+    value >>= 7;
+  }
+
+  io_bytes.push_back((unsigned char)(value));
+}
+
+bool ReadVarUint(unsigned char const * & io_read, unsigned char const * end, uint64_t & o_value) {
+  o_value = 0;
+
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (io_read == end) {
+      return false;
+    }
+
+    unsigned char const byte = *io_read++;
+    o_value |= uint64_t(byte & 0x7F) << shift;
+
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void EncodeFrameDelta(
+  AsciiCell const *            previous,
+  AsciiCell const *            current,
+  int                          count,
+  std::vector<unsigned char> & io_bytes
+) {
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous, current, count, c_spanMergeDistance, spans);
+
+  WriteVarUint(spans.size(), io_bytes);
+
+  int cursor = 0;
+
+  for (CellSpan const & span : spans) {
+    WriteVarUint(span.begin - cursor, io_bytes);
+    WriteVarUint(span.Count(), io_bytes);
+
+    int index = span.begin;
+    while (index < span.end) {
+      int runEnd = index + 1;
+      while (runEnd < span.end && current[runEnd] == current[index]) {
+        ++runEnd;
+      }
+
+      WriteVarUint(runEnd - index, io_bytes);
+      WriteCell(current[index], io_bytes);
+
+      index = runEnd;
+    }
+
+    cursor = span.end;
+  }
+}
+
+bool DecodeFrameDelta(
+  unsigned char const * & io_read,
+  unsigned char const *   end,
+  AsciiCell *             io_cells,
+  int                     count
+) {
+  uint64_t spanCount = 0;
+  if (!ReadVarUint(io_read, end, spanCount)) {
+    return false;
+  }
+
+  uint64_t cursor = 0;
+
+  for (uint64_t span = 0; span < spanCount; ++span) {
+    uint64_t skip   = 0;
+    uint64_t length = 0;
+
+    if (!ReadVarUint(io_read, end, skip) || !ReadVarUint(io_read, end, length)) {
+      return false;
+    }
+
+    cursor += skip;
+
+    uint64_t const spanEnd = cursor + length;
+    if (spanEnd > uint64_t(count)) {
+      return false;
+    }
+
+    while (cursor < spanEnd) {
+      uint64_t  runLength = 0;
+      AsciiCell cell;
+
+      if (!ReadVarUint(io_read, end, runLength) || !ReadCell(io_read, end, cell)) {
+        return false;
+      }
+
+      if (runLength == 0 || runLength > spanEnd - cursor) {
+        return false;
+      }
+
+      for (uint64_t i = 0; i < runLength; ++i) {
+        io_cells[cursor++] = cell;
+      }
+    }
+  }
+
+  return true;
+}
+
+void WriteInputEvent(AsciiInputEvent const & event, std::vector<unsigned char> & io_bytes) {
+  WriteVarUint(uint64_t(event.type), io_bytes);
+
+  switch (event.type) {
+    case AsciiInputType::Button: {
+      WriteVarUint(ZigZag(int(event.buttonEvent.button)), io_bytes);
+      io_bytes.push_back(event.buttonEvent.isDown);
+    } break;
+
+    case AsciiInputType::MousePosition: {
+      WriteVarUint(ZigZag(event.mousePositionEvent.x), io_bytes);
+      WriteVarUint(ZigZag(event.mousePositionEvent.y), io_bytes);
+    } break;
+
+    case AsciiInputType::MouseScroll: {
+      WriteVarUint(ZigZag(event.mouseScrollEvent), io_bytes);
+    } break;
+
+    case AsciiInputType::State: {
+      WriteVarUint(uint64_t(event.stateEvent.state), io_bytes);
+      io_bytes.push_back(event.stateEvent.isActive);
+    } break;
+
+    case AsciiInputType::Resize: {
+      WriteVarUint(ZigZag(event.resizeEvent.x), io_bytes);
+      WriteVarUint(ZigZag(event.resizeEvent.y), io_bytes);
+    } break;
+
+    default: {
+    } break;
+  }
+}
+
+bool ReadInputEvent(unsigned char const * & io_read, unsigned char const * end, AsciiInputEvent & o_event) {
+  uint64_t type = 0;
+  if (!ReadVarUint(io_read, end, type)) {
+    return false;
+  }
+
+  o_event      = AsciiInputEvent();
+  o_event.type = AsciiInputType(type);
+
+  switch (o_event.type) {
+    case AsciiInputType::Button: {
+      int button = 0;
+      if (!ReadVarInt(io_read, end, button) || io_read == end) {
+        return false;
+      }
+
+      o_event.buttonEvent.button = AsciiButton(button);
+      o_event.buttonEvent.isDown = *io_read++ != 0;
+    } break;
+
+    case AsciiInputType::MousePosition: {
+      ivec2 position;
+      if (!ReadVarInt(io_read, end, position.x) || !ReadVarInt(io_read, end, position.y)) {
+        return false;
+      }
+
+      o_event.mousePositionEvent = position;
+    } break;
+
+    case AsciiInputType::MouseScroll: {
+      if (!ReadVarInt(io_read, end, o_event.mouseScrollEvent)) {
+        return false;
+      }
+    } break;
+
+    case AsciiInputType::State: {
+      uint64_t state = 0;
+      if (!ReadVarUint(io_read, end, state) || io_read == end) {
+        return false;
+      }
+
+      o_event.stateEvent.state    = AsciiState(state);
+      o_event.stateEvent.isActive = *io_read++ != 0;
+    } break;
+
+    case AsciiInputType::Resize: {
+      ivec2 size;
+      if (!ReadVarInt(io_read, end, size.x) || !ReadVarInt(io_read, end, size.y)) {
+        return false;
+      }
+
+      o_event.resizeEvent = size;
+    } break;
+
+    default: {
+    } break;
+  }
+
+  return true;
+}
+
+void WriteFont(AsciiFont const & font, std::vector<unsigned char> & io_bytes) {
+  WriteVarUint(ZigZag(font.size.x), io_bytes);
+  WriteVarUint(ZigZag(font.size.y), io_bytes);
+
+  for (Color const & color : font.colors) {
+    io_bytes.push_back(color.r);
+    io_bytes.push_back(color.g);
+    io_bytes.push_back(color.b);
+  }
+
+  for (PaletteCycle const & cycle : font.cycles) {
+    WriteVarUint(ZigZag(cycle.first), io_bytes);
+    WriteVarUint(ZigZag(cycle.count), io_bytes);
+    WriteVarUint(ZigZag(cycle.stepMs), io_bytes);
+    io_bytes.push_back(cycle.isSmooth ? 1 : 0);
+  }
+}
+
+bool ReadFont(unsigned char const * & io_read, unsigned char const * end, AsciiFont & o_font, uint64_t version) {
+  if (!ReadVarInt(io_read, end, o_font.size.x) || !ReadVarInt(io_read, end, o_font.size.y)) {
+    return false;
+  }
+
+  int const colorCount = version < 2 ? FontColorCount : PaletteColorCount;
+
+  if (end - io_read < colorCount * 3) {
+    return false;
+  }
+
+  for (int i = 0; i < colorCount; ++i) {
+    o_font.colors[i] = Color(io_read[0], io_read[1], io_read[2]);
+    io_read         += 3;
+  }
+
+  if (version < 2) {
+    return true;
+  }
+
+  for (PaletteCycle & cycle : o_font.cycles) {
+    if (!ReadVarInt(io_read, end, cycle.first) || !ReadVarInt(io_read, end, cycle.count) || !ReadVarInt(io_read, end, cycle.stepMs) || io_read == end) {
+      return false;
+    }
+
+    cycle.isSmooth = *io_read++ != 0;
+  }
+
+  return true;
+}
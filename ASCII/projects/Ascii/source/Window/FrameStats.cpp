@@ -0,0 +1,80 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/FrameStats.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+  // In AsciiFrameTime order. frameNs comes first so the first frame after a Clear can skip it.
+  FrameStatsRecorder::Stat const c_timeStats[] = {
+    &AsciiFrameStats::frameNs,
+    &AsciiFrameStats::drawNs,
+    &AsciiFrameStats::swapNs,
+    &AsciiFrameStats::pollNs,
+    &AsciiFrameStats::sleepNs,
+  };
+
+  int const c_timeStatCount = int(std::size(c_timeStats));
+
+  static_assert(std::size(c_timeStats) == size_t(AsciiFrameTime::Count));
+}
+
+FrameStatsRecorder::FrameStatsRecorder(void) :
+  m_history(HistoryCapacity),
+  m_times(c_timeStatCount)
+{}
+
+void FrameStatsRecorder::Clear(void) {
+  for (FrameTimeRecorder & times : m_times) {
+    times.Clear();
+  }
+
+  m_nextFrame    = 0;
+  m_frameCount   = 0;
+  m_currentFrame = AsciiFrameStats();
+  m_frameStartNs = -1;
+}
+
+void FrameStatsRecorder::Add(Stat stat, int64_t amount) {
+  m_currentFrame.*stat += amount;
+}
+
+void FrameStatsRecorder::EndFrame(int64_t runNs) {
+  int firstTimeStat = 1;
+
+  if (m_frameStartNs >= 0) {
+    m_currentFrame.frameNs = runNs - m_frameStartNs;
+    firstTimeStat          = 0;
+  }
+
+  for (int i = firstTimeStat; i < c_timeStatCount; ++i) {
+    m_times[i].AddFrame(m_currentFrame.*c_timeStats[i]);
+  }
+
+  m_history[m_nextFrame] = m_currentFrame;
+
+  m_nextFrame    = (m_nextFrame + 1) % HistoryCapacity;
+  m_currentFrame = AsciiFrameStats();
+  m_frameStartNs = runNs;
+
+  if (m_frameCount < HistoryCapacity) {
+    ++m_frameCount;
+  }
+}
+
+int FrameStatsRecorder::GetFrameCount(void) const {
+  return m_frameCount;
+}
+
+AsciiFrameStats const & FrameStatsRecorder::GetFrame(int age) const {
+  age = std::clamp(age, 0, std::max(m_frameCount - 1, 0));
+
+  return m_history[(m_nextFrame - 1 - age + HistoryCapacity) % HistoryCapacity];
+}
+
+FrameTimeRecorder const & FrameStatsRecorder::GetTimes(AsciiFrameTime time) const {
+  return m_times[int(time)];
+}
@@ -0,0 +1,78 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/FrameTimeRecorder.h"
+
+#include <algorithm>
+#include <cmath>
+
+FrameTimeRecorder::FrameTimeRecorder(void) :
+  m_buckets(BucketCount, 0)
+{}
+
+void FrameTimeRecorder::Clear(void) {
+  std::fill(m_buckets.begin(), m_buckets.end(), 0);
+
+  m_frameCount = 0;
+  m_totalNs    = 0;
+  m_minNs      = 0;
+  m_maxNs      = 0;
+}
+
+void FrameTimeRecorder::AddFrame(int64_t frameNs) {
+  frameNs = std::max<int64_t>(frameNs, 0);
+
+  int const bucket = int(std::min<int64_t>(frameNs / BucketNs, BucketCount - 1));
+  ++m_buckets[bucket];
+
+  m_minNs       = m_frameCount == 0 ? frameNs : std::min(m_minNs, frameNs);
+  m_maxNs       = std::max(m_maxNs, frameNs);
+  m_totalNs    += frameNs;
+  m_frameCount += 1;
+}
+
+int FrameTimeRecorder::GetFrameCount(void) const {
+  return m_frameCount;
+}
+
+int64_t FrameTimeRecorder::GetMinNs(void) const {
+  return m_minNs;
+}
+
+int64_t FrameTimeRecorder::GetMaxNs(void) const {
+  return m_maxNs;
+}
+
+int64_t FrameTimeRecorder::GetMeanNs(void) const {
+  if (m_frameCount == 0) {
+    return 0;
+  }
+
+  return m_totalNs / m_frameCount;
+}
+
+int64_t FrameTimeRecorder::GetPercentileNs(float percentile) const {
+  if (m_frameCount == 0) {
+    return 0;
+  }
+
+  int const targetFrame = std::clamp(int(std::ceil(percentile * m_frameCount)), 1, m_frameCount);
+  int       seenFrames  = 0;
+  int       bucket      = 0;
+
+  for (; bucket < BucketCount; ++bucket) {
+    seenFrames += m_buckets[bucket];
+
+    if (seenFrames >= targetFrame) {
+      break;
+    }
+  }
+
+  // The last bucket has no upper edge.
+  if (seenFrames < targetFrame || bucket == BucketCount - 1) {
+    return m_maxNs;
+  }
+
+  return std::min((bucket + 1) * BucketNs, m_maxNs);
+}
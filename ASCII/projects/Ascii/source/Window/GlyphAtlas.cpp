@@ -0,0 +1,260 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/GlyphAtlas.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#ifdef WIN32
+  #define WIN32_LEAN_AND_MEAN
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <Windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "Window/BlockFont.h"
+#include "Window/Window.h"
+
+namespace {
+  static_assert(GlyphAtlasPageGlyphCount * GlyphAtlasMaxPageCount == PackedGlyphCount);
+
+  int const c_glyphsPerSide = 16;
+
+  // Version 1 headers end before the page count.
+  int const c_versionOneHeaderSize = GlyphAtlasMagicSize + 3 * 4;
+
+  // Glyphs bigger than this are certainly a corrupt header rather than a font.
+  uint32_t const c_maxGlyphSize = 1024;
+
+  std::mutex                        s_atlasMutex;
+  std::shared_ptr<GlyphAtlas const> s_atlas;
+
+  // Counts SetGlyphAtlas calls, so caches can tell their atlas is still current without the lock.
+  std::atomic<int> s_atlasGeneration = 0;
+
+  void WriteUint32(uint32_t value, std::vector<unsigned char> & io_bytes) {
+    for (int i = 0; i < 4; ++i) {
+      io_bytes.push_back((unsigned char)(value >> (i * 8)));
+    }
+  }
+
+  uint32_t ReadUint32(unsigned char const * bytes) {
+    return uint32_t(bytes[0]) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]) << 16) | (uint32_t(bytes[3]) << 24);
+  }
+
+  size_t GetSheetBytes(ivec2 const & glyphSize, int pageCount) {
+    return size_t(glyphSize.x) * glyphSize.y * c_glyphsPerSide * c_glyphsPerSide * pageCount;
+  }
+
+  std::shared_ptr<GlyphAtlas const> GetCompiledInAtlas(void) {
+    static std::shared_ptr<GlyphAtlas const> const s_compiledIn = std::make_shared<GlyphAtlas>(GetBlockFontGlyphSize(), GetBlockFontSheet());
+
+    return s_compiledIn;
+  }
+
+  std::shared_ptr<GlyphAtlas const> GetStartupAtlas(void) {
+    char const * const path = std::getenv("ASCII_GLYPH_ATLAS");
+
+    if (path && *path) {
+      if (std::shared_ptr<GlyphAtlas const> const atlas = GlyphAtlas::Load(path)) {
+        return atlas;
+      }
+    }
+
+    return GetCompiledInAtlas();
+  }
+}
+
+std::shared_ptr<GlyphAtlas const> GlyphAtlas::Load(std::string const & path) {
+  std::shared_ptr<GlyphAtlas> atlas(new GlyphAtlas());
+
+#ifdef WIN32
+  HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  LARGE_INTEGER fileSize;
+  HANDLE        mapping = nullptr;
+
+  if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  }
+
+  // The view keeps the file mapped after both handles are closed.
+  if (mapping) {
+    atlas->m_mapping     = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    atlas->m_mappingSize = size_t(fileSize.QuadPart);
+
+    CloseHandle(mapping);
+  }
+
+  CloseHandle(file);
+#else
+  int const file = open(path.c_str(), O_RDONLY);
+  if (file < 0) {
+    return nullptr;
+  }
+
+  struct stat fileInfo;
+
+  if (fstat(file, &fileInfo) == 0 && fileInfo.st_size > 0) {
+    void * const mapping = mmap(nullptr, size_t(fileInfo.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+    if (mapping != MAP_FAILED) {
+      atlas->m_mapping     = mapping;
+      atlas->m_mappingSize = size_t(fileInfo.st_size);
+    }
+  }
+
+  // The mapping keeps the file open on its own.
+  close(file);
+#endif
+
+  if (!atlas->m_mapping) {
+    return nullptr;
+  }
+
+  if (!ParseGlyphAtlas(reinterpret_cast<unsigned char const *>(atlas->m_mapping), atlas->m_mappingSize, atlas->m_glyphSize, atlas->m_pageCount, atlas->m_sheet)) {
+    return nullptr;
+  }
+
+  return atlas;
+}
+
+GlyphAtlas::GlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet) :
+  GlyphAtlas(glyphSize, sheet, 1)
+{}
+
+GlyphAtlas::GlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet, int pageCount) :
+  m_glyphSize(glyphSize),
+  m_pageCount(pageCount),
+  m_sheet(sheet)
+{}
+
+GlyphAtlas::~GlyphAtlas(void) {
+  if (!m_mapping) {
+    return;
+  }
+
+#ifdef WIN32
+  UnmapViewOfFile(m_mapping);
+#else
+  munmap(m_mapping, m_mappingSize);
+#endif
+}
+
+ivec2 GlyphAtlas::GetGlyphSize(void) const {
+  return m_glyphSize;
+}
+
+unsigned char const * GlyphAtlas::GetGlyphSheet(void) const {
+  return m_sheet;
+}
+
+int GlyphAtlas::GetPageCount(void) const {
+  return m_pageCount;
+}
+
+int GlyphAtlas::GetGlyphCount(void) const {
+  return m_pageCount * GlyphAtlasPageGlyphCount;
+}
+
+void WriteGlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet, std::vector<unsigned char> & io_bytes) {
+  WriteGlyphAtlas(glyphSize, sheet, 1, io_bytes);
+}
+
+void WriteGlyphAtlas(ivec2 const & glyphSize, unsigned char const * sheet, int pageCount, std::vector<unsigned char> & io_bytes) {
+  io_bytes.insert(io_bytes.end(), GlyphAtlasMagic, GlyphAtlasMagic + GlyphAtlasMagicSize);
+
+  WriteUint32(GlyphAtlasVersion, io_bytes);
+  WriteUint32(uint32_t(glyphSize.x), io_bytes);
+  WriteUint32(uint32_t(glyphSize.y), io_bytes);
+  WriteUint32(uint32_t(pageCount), io_bytes);
+
+  io_bytes.insert(io_bytes.end(), sheet, sheet + GetSheetBytes(glyphSize, pageCount));
+}
+
+bool ParseGlyphAtlas(unsigned char const * bytes, size_t size, ivec2 & o_glyphSize, unsigned char const * & o_sheet) {
+  int pageCount = 0;
+
+  return ParseGlyphAtlas(bytes, size, o_glyphSize, pageCount, o_sheet);
+}
+
+bool ParseGlyphAtlas(unsigned char const * bytes, size_t size, ivec2 & o_glyphSize, int & o_pageCount, unsigned char const * & o_sheet) {
+  if (size < size_t(c_versionOneHeaderSize) || std::memcmp(bytes, GlyphAtlasMagic, GlyphAtlasMagicSize) != 0) {
+    return false;
+  }
+
+  uint32_t const version = ReadUint32(bytes + GlyphAtlasMagicSize);
+  uint32_t const width   = ReadUint32(bytes + GlyphAtlasMagicSize + 4);
+  uint32_t const height  = ReadUint32(bytes + GlyphAtlasMagicSize + 8);
+
+  if (version == 0 || version > GlyphAtlasVersion || width == 0 || height == 0 || width > c_maxGlyphSize || height > c_maxGlyphSize) {
+    return false;
+  }
+
+  size_t const headerSize = version == 1 ? c_versionOneHeaderSize : GlyphAtlasHeaderSize;
+
+  if (size < headerSize) {
+    return false;
+  }
+
+  uint32_t const pageCount = version == 1 ? 1 : ReadUint32(bytes + GlyphAtlasMagicSize + 12);
+
+  if (pageCount == 0 || pageCount > uint32_t(GlyphAtlasMaxPageCount)) {
+    return false;
+  }
+
+  ivec2 const glyphSize = ivec2(int(width), int(height));
+
+  if (size - headerSize < GetSheetBytes(glyphSize, int(pageCount))) {
+    return false;
+  }
+
+  o_glyphSize = glyphSize;
+  o_pageCount = int(pageCount);
+  o_sheet     = bytes + headerSize;
+
+  return true;
+}
+
+std::shared_ptr<GlyphAtlas const> GetGlyphAtlas(void) {
+  std::lock_guard<std::mutex> const lock(s_atlasMutex);
+
+  if (!s_atlas) {
+    s_atlas = GetStartupAtlas();
+  }
+
+  return s_atlas;
+}
+
+void SetGlyphAtlas(std::shared_ptr<GlyphAtlas const> const & atlas) {
+  std::lock_guard<std::mutex> const lock(s_atlasMutex);
+
+  s_atlas = atlas ? atlas : GetCompiledInAtlas();
+
+  ++s_atlasGeneration;
+}
+
+std::shared_ptr<GlyphAtlas const> const & GlyphAtlasCache::Get(void) {
+  // Read before the atlas, so a SetGlyphAtlas in between only costs an extra refresh next time.
+  int const generation = s_atlasGeneration;
+
+  if (generation != m_generation) {
+    m_atlas      = GetGlyphAtlas();
+    m_generation = generation;
+  }
+
+  return m_atlas;
+}
@@ -0,0 +1,462 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/ImageConverter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define ASCII_IMAGECONVERTER_USE_SSE2
+#endif
+
+namespace {
+  int const c_glyphsPerRow = 16;
+  int const c_glyphCount   = 256;
+  int const c_laneCount    = 4;
+  int const c_maxSamples   = 16;
+  int const c_tileRows     = 4;
+
+  ivec2 const c_maxSampleSize = ivec2(4, 4);
+
+  // Candidates are tried from the space onwards so blank cells come out as spaces.
+  int const c_firstCandidate = ' ';
+
+  // Per color, the terms of its error against a glyph's weight and color sums, repeated once per lane.
+  int const c_paletteTermCount = 4;
+  int const c_paletteStride    = c_paletteTermCount * c_laneCount;
+
+  struct CellMatch {
+    int candidate  = 0;
+    int foreground = 0;
+    int background = 0;
+  };
+
+  // Finds the candidate and colors with the least squared error against the samples, which are
+  // sampleCount reds, then greens, then blues. Covered samples count against the foreground and the
+  // rest against the background, so for each side the error of a color is
+  //   weight * |color|^2 - 2 * color . sum
+  // plus terms every choice shares, where sum is the samples' colors weighted by coverage. The sums
+  // are the correlation of the samples with each candidate's coverage.
+  CellMatch MatchCell(
+    float const * samples,
+    int           sampleCount,
+    float const * coverage,
+    float const * coverageSums,
+    int           candidateCount,
+    float const * paletteTerms,
+    int           colorCount
+  ) {
+    float const * const samplesR = samples;
+    float const * const samplesG = samples + sampleCount;
+    float const * const samplesB = samples + 2 * sampleCount;
+
+    float totalR = 0.0f;
+    float totalG = 0.0f;
+    float totalB = 0.0f;
+
+    for (int sample = 0; sample < sampleCount; ++sample) {
+      totalR += samplesR[sample];
+      totalG += samplesG[sample];
+      totalB += samplesB[sample];
+    }
+
+#ifdef ASCII_IMAGECONVERTER_USE_SSE2
+    __m128 splatR[c_maxSamples];
+    __m128 splatG[c_maxSamples];
+    __m128 splatB[c_maxSamples];
+
+    for (int sample = 0; sample < sampleCount; ++sample) {
+      splatR[sample] = _mm_set1_ps(samplesR[sample]);
+      splatG[sample] = _mm_set1_ps(samplesG[sample]);
+      splatB[sample] = _mm_set1_ps(samplesB[sample]);
+    }
+
+    __m128 const  totalsR      = _mm_set1_ps(totalR);
+    __m128 const  totalsG      = _mm_set1_ps(totalG);
+    __m128 const  totalsB      = _mm_set1_ps(totalB);
+    __m128 const  sampleWeight = _mm_set1_ps(float(sampleCount));
+    __m128 const  maxCost      = _mm_set1_ps(std::numeric_limits<float>::max());
+    __m128i const laneOffsets  = _mm_set_epi32(3, 2, 1, 0);
+
+    __m128  bestCosts       = maxCost;
+    __m128i bestCandidates  = _mm_setzero_si128();
+    __m128i bestForegrounds = _mm_setzero_si128();
+    __m128i bestBackgrounds = _mm_setzero_si128();
+
+    auto const select = [](__m128i isBetter, __m128i better, __m128i current) {
+      return _mm_or_si128(_mm_and_si128(isBetter, better), _mm_andnot_si128(isBetter, current));
+    };
+
+    // Everything for four candidates at a time stays in registers from correlation to picking colors.
+    for (int i = 0; i < candidateCount; i += c_laneCount) {
+      __m128 foreR = _mm_setzero_ps();
+      __m128 foreG = _mm_setzero_ps();
+      __m128 foreB = _mm_setzero_ps();
+
+      for (int sample = 0; sample < sampleCount; ++sample) {
+        __m128 const covered = _mm_loadu_ps(coverage + size_t(sample) * candidateCount + i);
+
+        foreR = _mm_add_ps(foreR, _mm_mul_ps(covered, splatR[sample]));
+        foreG = _mm_add_ps(foreG, _mm_mul_ps(covered, splatG[sample]));
+        foreB = _mm_add_ps(foreB, _mm_mul_ps(covered, splatB[sample]));
+      }
+
+      __m128 const foreWeight = _mm_loadu_ps(coverageSums + i);
+      __m128 const backWeight = _mm_sub_ps(sampleWeight, foreWeight);
+      __m128 const backR      = _mm_sub_ps(totalsR, foreR);
+      __m128 const backG      = _mm_sub_ps(totalsG, foreG);
+      __m128 const backB      = _mm_sub_ps(totalsB, foreB);
+
+      __m128  foreCost  = maxCost;
+      __m128  backCost  = maxCost;
+      __m128i foreColor = _mm_setzero_si128();
+      __m128i backColor = _mm_setzero_si128();
+
+      for (int color = 0; color < colorCount; ++color) {
+        float const * const terms     = paletteTerms + color * c_paletteStride;
+        __m128 const        termR     = _mm_loadu_ps(terms);
+        __m128 const        termG     = _mm_loadu_ps(terms + c_laneCount);
+        __m128 const        termB     = _mm_loadu_ps(terms + 2 * c_laneCount);
+        __m128 const        lengthSqr = _mm_loadu_ps(terms + 3 * c_laneCount);
+        __m128i const       colors    = _mm_set1_epi32(color);
+
+        __m128 fore = _mm_mul_ps(foreWeight, lengthSqr);
+        fore = _mm_add_ps(fore, _mm_mul_ps(foreR, termR));
+        fore = _mm_add_ps(fore, _mm_mul_ps(foreG, termG));
+        fore = _mm_add_ps(fore, _mm_mul_ps(foreB, termB));
+
+        __m128 back = _mm_mul_ps(backWeight, lengthSqr);
+        back = _mm_add_ps(back, _mm_mul_ps(backR, termR));
+        back = _mm_add_ps(back, _mm_mul_ps(backG, termG));
+        back = _mm_add_ps(back, _mm_mul_ps(backB, termB));
+
+        foreColor = select(_mm_castps_si128(_mm_cmplt_ps(fore, foreCost)), colors, foreColor);
+        backColor = select(_mm_castps_si128(_mm_cmplt_ps(back, backCost)), colors, backColor);
+        foreCost  = _mm_min_ps(fore, foreCost);
+        backCost  = _mm_min_ps(back, backCost);
+      }
+
+      __m128 const  cost     = _mm_add_ps(foreCost, backCost);
+      __m128i const isBetter = _mm_castps_si128(_mm_cmplt_ps(cost, bestCosts));
+
+      bestCandidates  = select(isBetter, _mm_add_epi32(_mm_set1_epi32(i), laneOffsets), bestCandidates);
+      bestForegrounds = select(isBetter, foreColor, bestForegrounds);
+      bestBackgrounds = select(isBetter, backColor, bestBackgrounds);
+      bestCosts       = _mm_min_ps(cost, bestCosts);
+    }
+
+    float laneCosts[c_laneCount];
+    int   laneCandidates[c_laneCount];
+    int   laneForegrounds[c_laneCount];
+    int   laneBackgrounds[c_laneCount];
+
+    _mm_storeu_ps(laneCosts, bestCosts);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneCandidates), bestCandidates);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneForegrounds), bestForegrounds);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(laneBackgrounds), bestBackgrounds);
+
+    // Ties go to the earlier candidate, the same as checking them one at a time.
+    int best = 0;
+    for (int lane = 1; lane < c_laneCount; ++lane) {
+      if (laneCosts[lane] < laneCosts[best] || (laneCosts[lane] == laneCosts[best] && laneCandidates[lane] < laneCandidates[best])) {
+        best = lane;
+      }
+    }
+
+    CellMatch match;
+    match.candidate  = laneCandidates[best];
+    match.foreground = laneForegrounds[best];
+    match.background = laneBackgrounds[best];
+
+    return match;
+#else
+    CellMatch match;
+    float     bestCost = std::numeric_limits<float>::max();
+
+    for (int i = 0; i < candidateCount; ++i) {
+      float foreR = 0.0f;
+      float foreG = 0.0f;
+      float foreB = 0.0f;
+
+      for (int sample = 0; sample < sampleCount; ++sample) {
+        float const covered = coverage[size_t(sample) * candidateCount + i];
+
+        foreR += covered * samplesR[sample];
+        foreG += covered * samplesG[sample];
+        foreB += covered * samplesB[sample];
+      }
+
+      float const foreWeight = coverageSums[i];
+      float const backWeight = float(sampleCount) - foreWeight;
+
+      float foreCost  = std::numeric_limits<float>::max();
+      float backCost  = std::numeric_limits<float>::max();
+      int   foreColor = 0;
+      int   backColor = 0;
+
+      for (int color = 0; color < colorCount; ++color) {
+        float const * const terms = paletteTerms + color * c_paletteStride;
+
+        float const fore = foreWeight * terms[3 * c_laneCount] + foreR * terms[0] + foreG * terms[c_laneCount] + foreB * terms[2 * c_laneCount];
+        float const back =
+          backWeight * terms[3 * c_laneCount] +
+          (totalR - foreR) * terms[0] + (totalG - foreG) * terms[c_laneCount] + (totalB - foreB) * terms[2 * c_laneCount]
+        ;
+
+        if (fore < foreCost) {
+          foreCost  = fore;
+          foreColor = color;
+        }
+        if (back < backCost) {
+          backCost  = back;
+          backColor = color;
+        }
+      }
+
+      if (foreCost + backCost < bestCost) {
+        bestCost         = foreCost + backCost;
+        match.candidate  = i;
+        match.foreground = foreColor;
+        match.background = backColor;
+      }
+    }
+
+    return match;
+#endif
+  }
+}
+
+AsciiImageConverter::AsciiImageConverter(void) :
+  AsciiImageConverter(GetGlyphAtlas())
+{}
+
+AsciiImageConverter::AsciiImageConverter(std::shared_ptr<GlyphAtlas const> const & atlas) :
+  m_sampleSize(atlas->GetGlyphSize().Min(c_maxSampleSize)),
+  m_candidateCount(0),
+  m_paddedCandidateCount(0),
+  m_threadCount(std::max(1, int(std::thread::hardware_concurrency())))
+{
+  ivec2 const                 glyphSize   = atlas->GetGlyphSize();
+  unsigned char const * const sheet       = atlas->GetGlyphSheet();
+  int const                   sheetWidth  = c_glyphsPerRow * glyphSize.x;
+  int const                   sampleCount = m_sampleSize.Product();
+
+  std::vector<PixelRun> columns;
+  std::vector<PixelRun> rows;
+  FindSampleRuns(glyphSize.x, m_sampleSize.x, columns);
+  FindSampleRuns(glyphSize.y, m_sampleSize.y, rows);
+
+  // Coverage of each sample by each glyph, dropping glyphs that look like one already kept.
+  std::vector<float> glyphCoverage(size_t(c_glyphCount) * sampleCount);
+  std::vector<float> keptCoverage;
+
+  for (int i = 0; i < c_glyphCount; ++i) {
+    int const   glyph    = (c_firstCandidate + i) % c_glyphCount;
+    ivec2 const sheetPos = ivec2(glyph % c_glyphsPerRow, glyph / c_glyphsPerRow) * glyphSize;
+    float *     coverage = glyphCoverage.data() + size_t(i) * sampleCount;
+
+    for (int sample = 0; sample < sampleCount; ++sample) {
+      int const sampleX  = sample % m_sampleSize.x;
+      int const sampleY  = sample / m_sampleSize.x;
+      int       setCount = 0;
+
+      for (int y = rows[sampleY].begin; y < rows[sampleY].end; ++y) {
+        for (int x = columns[sampleX].begin; x < columns[sampleX].end; ++x) {
+          setCount += sheet[(sheetPos.y + y) * sheetWidth + sheetPos.x + x] != 0;
+        }
+      }
+
+      coverage[sample] = float(setCount) / float(rows[sampleY].Count() * columns[sampleX].Count());
+    }
+
+    // A glyph's inverse draws the same thing with its colors swapped, so it's a duplicate as well.
+    bool isDuplicate = false;
+    for (int kept = 0; kept < m_candidateCount && !isDuplicate; ++kept) {
+      float const * keptGlyph = keptCoverage.data() + size_t(kept) * sampleCount;
+
+      isDuplicate =
+        std::equal(coverage, coverage + sampleCount, keptGlyph) ||
+        std::equal(coverage, coverage + sampleCount, keptGlyph, [](float a, float b) { return a == 1.0f - b; })
+      ;
+    }
+
+    if (!isDuplicate) {
+      keptCoverage.insert(keptCoverage.end(), coverage, coverage + sampleCount);
+      m_candidateGlyphs.push_back((unsigned char)glyph);
+      ++m_candidateCount;
+    }
+  }
+
+  // Stored sample major so each sample's coverage of every candidate is contiguous. Padding
+  // candidates are blank, and never win since the space comes before them.
+  m_paddedCandidateCount = (m_candidateCount + c_laneCount - 1) / c_laneCount * c_laneCount;
+  m_candidateGlyphs.resize(m_paddedCandidateCount, (unsigned char)c_firstCandidate);
+  m_coverage.assign(size_t(sampleCount) * m_paddedCandidateCount, 0.0f);
+  m_coverageSums.assign(m_paddedCandidateCount, 0.0f);
+
+  for (int candidate = 0; candidate < m_candidateCount; ++candidate) {
+    for (int sample = 0; sample < sampleCount; ++sample) {
+      float const coverage = keptCoverage[size_t(candidate) * sampleCount + sample];
+
+      m_coverage[size_t(sample) * m_paddedCandidateCount + candidate]  = coverage;
+      m_coverageSums[candidate]                                       += coverage;
+    }
+  }
+}
+
+void AsciiImageConverter::Convert(Grid<Color, 2> const & image, std::span<Color const> palette, Grid<AsciiCell, 2> & io_cells) {
+  ivec2 const cellCount = io_cells.GetSize();
+
+  if (cellCount.x <= 0 || cellCount.y <= 0) {
+    return;
+  }
+
+  palette = palette.first(std::min<size_t>(palette.size(), PaletteColorCount));
+
+  if (image.GetSize().x <= 0 || image.GetSize().y <= 0 || palette.empty()) {
+    std::fill(io_cells.begin(), io_cells.end(), AsciiCell());
+    return;
+  }
+
+  m_paletteTerms.resize(palette.size() * c_paletteStride);
+  for (size_t color = 0; color < palette.size(); ++color) {
+    float const r     = palette[color].r;
+    float const g     = palette[color].g;
+    float const b     = palette[color].b;
+    float *     terms = m_paletteTerms.data() + color * c_paletteStride;
+
+    std::fill(terms, terms + c_laneCount, -2.0f * r);
+    std::fill(terms + c_laneCount, terms + 2 * c_laneCount, -2.0f * g);
+    std::fill(terms + 2 * c_laneCount, terms + 3 * c_laneCount, -2.0f * b);
+    std::fill(terms + 3 * c_laneCount, terms + 4 * c_laneCount, r * r + g * g + b * b);
+  }
+
+  FindSampleRuns(image.GetSize().x, cellCount.x * m_sampleSize.x, m_sampleColumns);
+  FindSampleRuns(image.GetSize().y, cellCount.y * m_sampleSize.y, m_sampleRows);
+
+  int const        tileCount   = (cellCount.y + c_tileRows - 1) / c_tileRows;
+  int const        threadCount = std::min(m_threadCount, tileCount);
+  std::atomic<int> nextTile    = 0;
+
+  auto const work = [&](void) {
+    for (int tile = nextTile++; tile < tileCount; tile = nextTile++) {
+      ConvertRows(image, tile * c_tileRows, std::min(cellCount.y, (tile + 1) * c_tileRows), io_cells);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < threadCount; ++i) {
+    threads.emplace_back(work);
+  }
+
+  work();
+
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+}
+
+int AsciiImageConverter::GetThreadCount(void) const {
+  return m_threadCount;
+}
+
+void AsciiImageConverter::SetThreadCount(int threadCount) {
+  m_threadCount = std::max(1, threadCount);
+}
+
+int AsciiImageConverter::GetCandidateCount(void) const {
+  return m_candidateCount;
+}
+
+void AsciiImageConverter::FindSampleRuns(int size, int count, std::vector<PixelRun> & o_runs) {
+  o_runs.resize(count);
+
+  for (int i = 0; i < count; ++i) {
+    o_runs[i].begin = int(int64_t(i) * size / count);
+    o_runs[i].end   = int(int64_t(i + 1) * size / count);
+
+    if (o_runs[i].end == o_runs[i].begin) {
+      o_runs[i].begin = int((2 * int64_t(i) + 1) * size / (2 * int64_t(count)));
+      o_runs[i].end   = o_runs[i].begin + 1;
+    }
+  }
+}
+
+void AsciiImageConverter::ConvertRows(Grid<Color, 2> const & image, int beginRow, int endRow, Grid<AsciiCell, 2> & io_cells) const {
+  int const           sampleCount = m_sampleSize.Product();
+  int const           cellCountX  = io_cells.GetSize().x;
+  int const           columnCount = cellCountX * m_sampleSize.x;
+  int const           imageWidth  = image.GetSize().x;
+  int const           colorCount  = int(m_paletteTerms.size() / c_paletteStride);
+  Color const * const pixels      = image.Data();
+
+  // Each cell's samples, laid out the way MatchCell reads them.
+  std::vector<int>   columnSums(size_t(imageWidth) * 3);
+  std::vector<float> samples(size_t(cellCountX) * sampleCount * 3);
+
+  for (int cellY = beginRow; cellY < endRow; ++cellY) {
+    // Box filters the image under each sample, a row of samples at a time.
+    for (int sampleY = 0; sampleY < m_sampleSize.y; ++sampleY) {
+      int const row = cellY * m_sampleSize.y + sampleY;
+
+      std::fill(columnSums.begin(), columnSums.end(), 0);
+
+      for (int y = m_sampleRows[row].begin; y < m_sampleRows[row].end; ++y) {
+        Color const * const pixelRow = pixels + size_t(y) * imageWidth;
+
+        for (int x = 0; x < imageWidth; ++x) {
+          columnSums[3 * x]     += pixelRow[x].r;
+          columnSums[3 * x + 1] += pixelRow[x].g;
+          columnSums[3 * x + 2] += pixelRow[x].b;
+        }
+      }
+
+      int const rowHeight = m_sampleRows[row].Count();
+
+      for (int column = 0; column < columnCount; ++column) {
+        int r = 0;
+        int g = 0;
+        int b = 0;
+
+        for (int x = m_sampleColumns[column].begin; x < m_sampleColumns[column].end; ++x) {
+          r += columnSums[3 * x];
+          g += columnSums[3 * x + 1];
+          b += columnSums[3 * x + 2];
+        }
+
+        float const   area   = float(rowHeight * m_sampleColumns[column].Count());
+        int const     sample = sampleY * m_sampleSize.x + column % m_sampleSize.x;
+        float * const cell   = samples.data() + size_t(column / m_sampleSize.x) * sampleCount * 3;
+
+        cell[sample]                   = float(r) / area;
+        cell[sampleCount + sample]     = float(g) / area;
+        cell[2 * sampleCount + sample] = float(b) / area;
+      }
+    }
+
+    for (int cellX = 0; cellX < cellCountX; ++cellX) {
+      CellMatch const match = MatchCell(
+        samples.data() + size_t(cellX) * sampleCount * 3,
+        sampleCount,
+        m_coverage.data(),
+        m_coverageSums.data(),
+        m_paddedCandidateCount,
+        m_paletteTerms.data(),
+        colorCount
+      );
+
+      // Any glyph in a single color ties with the space, so rounding decides which wins.
+      if (match.foreground == match.background) {
+        io_cells[ivec2(cellX, cellY)] = AsciiCell((char)c_firstCandidate, (unsigned char)match.background, (unsigned char)match.background);
+      }
+      else {
+        io_cells[ivec2(cellX, cellY)] = AsciiCell((char)m_candidateGlyphs[match.candidate], (unsigned char)match.foreground, (unsigned char)match.background);
+      }
+    }
+  }
+}
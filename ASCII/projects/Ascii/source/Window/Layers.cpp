@@ -0,0 +1,63 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/Layers.h"
+
+#include <algorithm>
+
+namespace {
+  unsigned char ShiftBank(unsigned char color, int paletteBank) {
+    if (color == TransparentColor) {
+      return color;
+    }
+
+    return (unsigned char)((color + paletteBank * FontColorCount) % PaletteColorCount);
+  }
+
+  void CompositeCell(AsciiCell cell, int paletteBank, AsciiCell & io_dest) {
+    cell.foregroundColor = ShiftBank(cell.foregroundColor, paletteBank);
+    cell.backgroundColor = ShiftBank(cell.backgroundColor, paletteBank);
+
+    bool const isForegroundClear = cell.foregroundColor == TransparentColor;
+    bool const isBackgroundClear = cell.backgroundColor == TransparentColor;
+
+    if (!isForegroundClear && !isBackgroundClear) {
+      io_dest = cell;
+    }
+    else if (!isBackgroundClear) {
+      io_dest = AsciiCell(cell.character, io_dest.backgroundColor, cell.backgroundColor);
+    }
+    else if (!isForegroundClear) {
+      io_dest = AsciiCell(cell.character, cell.foregroundColor, io_dest.backgroundColor);
+    }
+  }
+}
+
+void CompositeLayers(ivec2 const & size, std::span<AsciiLayer const> layers, Grid<AsciiCell, 2> & o_grid) {
+  if (o_grid.GetSize() != size) {
+    o_grid = Grid<AsciiCell, 2>(size);
+  }
+  else {
+    std::fill(o_grid.begin(), o_grid.end(), AsciiCell());
+  }
+
+  for (AsciiLayer const & layer : layers) {
+    ivec2 const layerSize = layer.cells->GetSize();
+
+    // The part of the layer that lands inside the window, in layer coordinates.
+    int const beginX = std::max(0, -layer.offset.x);
+    int const beginY = std::max(0, -layer.offset.y);
+    int const endX   = std::min(layerSize.x, size.x - layer.offset.x);
+    int const endY   = std::min(layerSize.y, size.y - layer.offset.y);
+
+    for (int y = beginY; y < endY; ++y) {
+      AsciiCell const * const source = layer.cells->Data() + y * layerSize.x;
+      AsciiCell * const       dest   = o_grid.Data() + (y + layer.offset.y) * size.x + layer.offset.x;
+
+      for (int x = beginX; x < endX; ++x) {
+        CompositeCell(source[x], layer.paletteBank, dest[x]);
+      }
+    }
+  }
+}
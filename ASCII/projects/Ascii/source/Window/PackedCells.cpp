@@ -0,0 +1,59 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/PackedCells.h"
+
+namespace {
+  int const c_firstPageGlyphCount = 256;
+
+  int PackColor(unsigned char color) {
+    return color == TransparentColor ? PackedTransparentColor : color;
+  }
+
+  unsigned char UnpackColor(int color) {
+    if (color == PackedTransparentColor) {
+      return TransparentColor;
+    }
+
+    // Anything from TransparentColor up would read as something else, so it's wrapped instead.
+    return (unsigned char)(color < TransparentColor ? color : color % PaletteColorCount);
+  }
+}
+
+AsciiPackedCell PackCell(AsciiCell const & cell) {
+  return AsciiPackedCell((unsigned char)(cell.character), PackColor(cell.foregroundColor), PackColor(cell.backgroundColor));
+}
+
+AsciiCell UnpackCell(AsciiPackedCell const & cell) {
+  int const  glyph     = cell.GetGlyph();
+  char const character = glyph < c_firstPageGlyphCount ? char(glyph) : UnpackedFallbackCharacter;
+
+  return AsciiCell(character, UnpackColor(cell.GetForegroundColor()), UnpackColor(cell.GetBackgroundColor()));
+}
+
+void PackCells(Grid<AsciiCell, 2> const & cells, Grid<AsciiPackedCell, 2> & o_packed) {
+  if (o_packed.GetSize() != cells.GetSize()) {
+    o_packed = Grid<AsciiPackedCell, 2>(cells.GetSize());
+  }
+
+  AsciiCell const * const read  = cells.Data();
+  AsciiPackedCell * const write = o_packed.Data();
+
+  for (int i = 0; i < cells.Count(); ++i) {
+    write[i] = PackCell(read[i]);
+  }
+}
+
+void UnpackCells(Grid<AsciiPackedCell, 2> const & packed, Grid<AsciiCell, 2> & o_cells) {
+  if (o_cells.GetSize() != packed.GetSize()) {
+    o_cells = Grid<AsciiCell, 2>(packed.GetSize());
+  }
+
+  AsciiPackedCell const * const read  = packed.Data();
+  AsciiCell * const             write = o_cells.Data();
+
+  for (int i = 0; i < packed.Count(); ++i) {
+    write[i] = UnpackCell(read[i]);
+  }
+}
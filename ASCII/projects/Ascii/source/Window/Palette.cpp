@@ -0,0 +1,50 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/Palette.h"
+
+#include <algorithm>
+
+namespace {
+  unsigned char Blend(unsigned char from, unsigned char to, int weight, int total) {
+    return (unsigned char)((int(from) * (total - weight) + int(to) * weight) / total);
+  }
+}
+
+void EvaluatePalette(AsciiFont const & font, int runMs, Color * o_colors) {
+  std::copy(font.colors, font.colors + PaletteColorCount, o_colors);
+
+  runMs = std::max(runMs, 0);
+
+  // Backwards, so where cycles overlap the first one wins like it does in the shader.
+  for (int c = PaletteCycleCount - 1; c >= 0; --c) {
+    PaletteCycle const & cycle = font.cycles[c];
+
+    if (!IsPaletteCycleActive(cycle)) {
+      continue;
+    }
+
+    int const steps  = (runMs / cycle.stepMs) % cycle.count;
+    int const weight = cycle.isSmooth ? runMs % cycle.stepMs : 0;
+
+    for (int i = 0; i < cycle.count; ++i) {
+      Color const & from = font.colors[cycle.first + (i + steps) % cycle.count];
+      Color const & to   = font.colors[cycle.first + (i + steps + 1) % cycle.count];
+
+      o_colors[cycle.first + i] = Color(
+        Blend(from.r, to.r, weight, cycle.stepMs),
+        Blend(from.g, to.g, weight, cycle.stepMs),
+        Blend(from.b, to.b, weight, cycle.stepMs)
+      );
+    }
+  }
+}
+
+bool IsPaletteAnimated(AsciiFont const & font) {
+  return std::any_of(std::begin(font.cycles), std::end(font.cycles), IsPaletteCycleActive);
+}
+
+bool IsPaletteCycleActive(PaletteCycle const & cycle) {
+  return cycle.count > 1 && cycle.stepMs > 0 && cycle.first >= 0 && cycle.first + cycle.count <= PaletteColorCount;
+}
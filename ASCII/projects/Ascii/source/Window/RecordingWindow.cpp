@@ -0,0 +1,192 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/RecordingWindow.h"
+
+#include <algorithm>
+
+#include "Window/Layers.h"
+#include "Window/PackedCells.h"
+
+namespace {
+  int const c_flushThresholdBytes = 0x1 << 16;
+}
+
+RecordingAsciiWindow::RecordingAsciiWindow(
+  std::shared_ptr<IAsciiWindow> const & window,
+  std::shared_ptr<std::ostream> const & output
+) :
+  m_window(window),
+  m_output(output)
+{
+  m_pending.assign(RecordingMagic, RecordingMagic + RecordingMagicSize);
+  WriteVarUint(RecordingVersion, m_pending);
+
+  m_lastRecordUs = m_window->GetRunUs();
+
+  // Replays start with whatever font the player's window has, so record the one in use now.
+  m_payload.clear();
+  WriteFont(m_window->GetFont(), m_payload);
+
+  WriteRecord(RecordType::Font);
+}
+
+RecordingAsciiWindow::~RecordingAsciiWindow(void) {
+  Flush();
+}
+
+void RecordingAsciiWindow::Draw(Grid<AsciiCell, 2> const & draw) {
+  m_window->Draw(draw);
+
+  RecordFrame(draw);
+}
+
+void RecordingAsciiWindow::DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) {
+  m_window->DrawLayers(size, layers);
+
+  CompositeLayers(size, layers, m_compositedFrame);
+  RecordFrame(m_compositedFrame);
+}
+
+void RecordingAsciiWindow::DrawPacked(Grid<AsciiPackedCell, 2> const & draw) {
+  m_window->DrawPacked(draw);
+
+  UnpackCells(draw, m_compositedFrame);
+  RecordFrame(m_compositedFrame);
+}
+
+Grid<AsciiCell, 2> & RecordingAsciiWindow::AcquireBackbuffer(void) {
+  return m_window->AcquireBackbuffer();
+}
+
+std::vector<AsciiInputEvent> RecordingAsciiWindow::PollInput(void) {
+  std::vector<AsciiInputEvent> events = m_window->PollInput();
+
+  RecordInput(events);
+
+  return events;
+}
+
+std::span<AsciiInputEvent const> RecordingAsciiWindow::DrainInput(void) {
+  std::span<AsciiInputEvent const> const events = m_window->DrainInput();
+
+  RecordInput(events);
+
+  return events;
+}
+
+std::string RecordingAsciiWindow::GetClipboard(void) const {
+  return m_window->GetClipboard();
+}
+
+void RecordingAsciiWindow::SetClipboard(std::string const & clipboard) {
+  m_window->SetClipboard(clipboard);
+}
+
+std::string RecordingAsciiWindow::GetTitle(void) const {
+  return m_window->GetTitle();
+}
+
+void RecordingAsciiWindow::SetTitle(std::string const & title) {
+  m_window->SetTitle(title);
+}
+
+AsciiFont RecordingAsciiWindow::GetFont(void) const {
+  return m_window->GetFont();
+}
+
+void RecordingAsciiWindow::SetFont(AsciiFont const & font) {
+  m_window->SetFont(font);
+
+  m_payload.clear();
+  WriteFont(font, m_payload);
+
+  WriteRecord(RecordType::Font);
+}
+
+int RecordingAsciiWindow::GetRunMs(void) const {
+  return m_window->GetRunMs();
+}
+
+void RecordingAsciiWindow::Sleep(int milliseconds) {
+  m_window->Sleep(milliseconds);
+}
+
+int64_t RecordingAsciiWindow::GetRunUs(void) const {
+  return m_window->GetRunUs();
+}
+
+int64_t RecordingAsciiWindow::GetRunNs(void) const {
+  return m_window->GetRunNs();
+}
+
+void RecordingAsciiWindow::SleepUntilNs(int64_t runNs) {
+  m_window->SleepUntilNs(runNs);
+}
+
+FrameStatsRecorder const & RecordingAsciiWindow::GetFrameStats(void) const {
+  return m_window->GetFrameStats();
+}
+
+void RecordingAsciiWindow::Flush(void) {
+  if (m_pending.empty()) {
+    return;
+  }
+
+  m_output->write(reinterpret_cast<char const *>(m_pending.data()), m_pending.size());
+  m_output->flush();
+
+  m_flushedBytes += m_pending.size();
+  m_pending.clear();
+}
+
+int64_t RecordingAsciiWindow::GetRecordedBytes(void) const {
+  return m_flushedBytes + int64_t(m_pending.size());
+}
+
+void RecordingAsciiWindow::RecordFrame(Grid<AsciiCell, 2> const & frame) {
+  // A new size has nothing to diff against, so the frame is stored against blank cells.
+  if (m_previousFrame.GetSize() != frame.GetSize()) {
+    m_previousFrame = Grid<AsciiCell, 2>(frame.GetSize());
+  }
+
+  m_payload.clear();
+  WriteVarUint(frame.GetSize().x, m_payload);
+  WriteVarUint(frame.GetSize().y, m_payload);
+  EncodeFrameDelta(m_previousFrame.Data(), frame.Data(), frame.Count(), m_payload);
+
+  WriteRecord(RecordType::Frame);
+
+  m_previousFrame = frame;
+}
+
+void RecordingAsciiWindow::WriteRecord(RecordType type) {
+  int64_t const runUs = m_window->GetRunUs();
+
+  m_pending.push_back((unsigned char)(type));
+  WriteVarUint(uint64_t(std::max<int64_t>(runUs - m_lastRecordUs, 0)), m_pending);
+  WriteVarUint(m_payload.size(), m_pending);
+  m_pending.insert(m_pending.end(), m_payload.begin(), m_payload.end());
+
+  m_lastRecordUs = std::max(m_lastRecordUs, runUs);
+
+  if (int(m_pending.size()) >= c_flushThresholdBytes) {
+    Flush();
+  }
+}
+
+void RecordingAsciiWindow::RecordInput(std::span<AsciiInputEvent const> events) {
+  if (events.empty()) {
+    return;
+  }
+
+  m_payload.clear();
+  WriteVarUint(events.size(), m_payload);
+
+  for (AsciiInputEvent const & event : events) {
+    WriteInputEvent(event, m_payload);
+  }
+
+  WriteRecord(RecordType::Input);
+}
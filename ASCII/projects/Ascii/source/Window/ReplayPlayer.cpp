@@ -0,0 +1,201 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/ReplayPlayer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+  // Corrupt sizes are caught before they're allocated. Frames are never anywhere near this many
+  // cells across, and payloads are read a chunk at a time so a bad size can only cost one chunk
+  // more than the input actually holds.
+  uint64_t const c_maxFrameSide   = 0x1 << 14;
+  uint64_t const c_readChunkBytes = 0x1 << 20;
+}
+
+ReplayPlayer::ReplayPlayer(
+  std::shared_ptr<IAsciiWindow> const & window,
+  std::shared_ptr<std::istream> const & input
+) :
+  m_window(window),
+  m_input(input)
+{
+  char magic[RecordingMagicSize];
+  m_input->read(magic, RecordingMagicSize);
+
+  m_isValid =
+    m_input->gcount() == RecordingMagicSize &&
+    std::memcmp(magic, RecordingMagic, RecordingMagicSize) == 0 &&
+    ReadHeaderVarUint(m_version) &&
+    m_version >= 1 &&
+    m_version <= RecordingVersion
+  ;
+
+  // Streams that can't seek, like pipes, rely on payloads being read a chunk at a time instead.
+  std::streampos const position = m_input->tellg();
+  if (m_isValid && position != std::streampos(-1)) {
+    m_input->seekg(0, std::ios::end);
+    m_inputEnd = int64_t(m_input->tellg());
+    m_input->seekg(position);
+  }
+}
+
+bool ReplayPlayer::IsValid(void) const {
+  return m_isValid;
+}
+
+bool ReplayPlayer::Step(void) {
+  if (!m_isValid) {
+    return false;
+  }
+
+  int const type = m_input->get();
+  if (type == std::istream::traits_type::eof()) {
+    return false;
+  }
+
+  uint64_t deltaUs     = 0;
+  uint64_t payloadSize = 0;
+
+  if (!ReadHeaderVarUint(deltaUs) || !ReadHeaderVarUint(payloadSize)) {
+    return false;
+  }
+
+  if (!ReadPayload(payloadSize)) {
+    return false;
+  }
+
+  m_recordUs += int64_t(deltaUs);
+
+  return ApplyRecord(RecordType(type));
+}
+
+void ReplayPlayer::Play(ReplaySpeed speed) {
+  m_speed   = speed;
+  m_startNs = m_window->GetRunNs() - m_recordUs * 1000;
+
+  while (Step()) {}
+}
+
+Grid<AsciiCell, 2> const & ReplayPlayer::GetFrame(void) const {
+  return m_frame;
+}
+
+int ReplayPlayer::GetFrameCount(void) const {
+  return m_frameCount;
+}
+
+std::vector<AsciiInputEvent> const & ReplayPlayer::GetLastInput(void) const {
+  return m_lastInput;
+}
+
+int64_t ReplayPlayer::GetRecordUs(void) const {
+  return m_recordUs;
+}
+
+bool ReplayPlayer::ReadHeaderVarUint(uint64_t & o_value) {
+  // Varints are at most 10 bytes, so read them a byte at a time rather than guessing a size.
+  unsigned char bytes[10];
+  int           count = 0;
+
+  do {
+    int const byte = m_input->get();
+    if (byte == std::istream::traits_type::eof()) {
+      return false;
+    }
+
+    bytes[count++] = (unsigned char)(byte);
+  } while ((bytes[count - 1] & 0x80) && count < 10);
+
+  unsigned char const * read = bytes;
+  return ReadVarUint(read, bytes + count, o_value);
+}
+
+bool ReplayPlayer::ReadPayload(uint64_t payloadSize) {
+  if (m_inputEnd >= 0 && payloadSize > uint64_t(std::max<int64_t>(m_inputEnd - int64_t(m_input->tellg()), 0))) {
+    return false;
+  }
+
+  m_payload.clear();
+
+  while (m_payload.size() < payloadSize) {
+    size_t const offset = m_payload.size();
+    size_t const count  = size_t(std::min(payloadSize - offset, c_readChunkBytes));
+
+    m_payload.resize(offset + count);
+    m_input->read(reinterpret_cast<char *>(m_payload.data() + offset), count);
+
+    if (size_t(m_input->gcount()) != count) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool ReplayPlayer::ApplyRecord(RecordType type) {
+  unsigned char const *       read = m_payload.data();
+  unsigned char const * const end  = read + m_payload.size();
+
+  switch (type) {
+    case RecordType::Frame: {
+      uint64_t width  = 0;
+      uint64_t height = 0;
+
+      if (!ReadVarUint(read, end, width) || !ReadVarUint(read, end, height) || width > c_maxFrameSide || height > c_maxFrameSide) {
+        return false;
+      }
+
+      ivec2 const size = ivec2(int(width), int(height));
+      if (m_frame.GetSize() != size) {
+        m_frame = Grid<AsciiCell, 2>(size);
+      }
+
+      if (!DecodeFrameDelta(read, end, m_frame.Data(), m_frame.Count())) {
+        return false;
+      }
+
+      if (m_speed == ReplaySpeed::Original) {
+        m_window->SleepUntilNs(m_startNs + m_recordUs * 1000);
+      }
+
+      m_window->Draw(m_frame);
+      ++m_frameCount;
+    } break;
+
+    case RecordType::Input: {
+      uint64_t count = 0;
+      if (!ReadVarUint(read, end, count)) {
+        return false;
+      }
+
+      m_lastInput.clear();
+
+      for (uint64_t i = 0; i < count; ++i) {
+        AsciiInputEvent event;
+        if (!ReadInputEvent(read, end, event)) {
+          return false;
+        }
+
+        m_lastInput.emplace_back(event);
+      }
+    } break;
+
+    case RecordType::Font: {
+      AsciiFont font;
+      if (!ReadFont(read, end, font, m_version)) {
+        return false;
+      }
+
+      m_window->SetFont(font);
+    } break;
+
+    default: {
+      // Unknown records are skipped so newer recordings still play.
+    } break;
+  }
+
+  return true;
+}
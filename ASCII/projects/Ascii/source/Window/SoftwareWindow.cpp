@@ -0,0 +1,341 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/SoftwareWindow.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define ASCII_SOFTWAREWINDOW_USE_SSE2
+#endif
+
+#include "Window/GlyphAtlas.h"
+#include "Window/Layers.h"
+#include "Window/PackedCells.h"
+#include "Window/Palette.h"
+
+namespace {
+  static_assert(sizeof(Color) == 3);
+
+  int const c_glyphsPerRow = 16;
+
+  int64_t const c_nsPerUs = 1000;
+  int64_t const c_nsPerMs = 1000000;
+
+  // Transparent cells show color 0, as they do over the GL window's clear color. Other colors past
+  // the palette wrap.
+  int GetPaletteIndex(int color) {
+    return color == PackedTransparentColor ? 0 : color % PaletteColorCount;
+  }
+
+  // Picks each byte from foreground where the mask is set and from background otherwise.
+  void BlendRow(
+    unsigned char *       o_dest,
+    unsigned char const * foreground,
+    unsigned char const * background,
+    unsigned char const * mask,
+    int                   byteCount
+  ) {
+    int i = 0;
+
+#ifdef ASCII_SOFTWAREWINDOW_USE_SSE2
+    for (; i + 16 <= byteCount; i += 16) {
+      __m128i const fore = _mm_loadu_si128(reinterpret_cast<__m128i const *>(foreground + i));
+      __m128i const back = _mm_loadu_si128(reinterpret_cast<__m128i const *>(background + i));
+      __m128i const bits = _mm_loadu_si128(reinterpret_cast<__m128i const *>(mask + i));
+
+      __m128i const blended = _mm_or_si128(_mm_and_si128(bits, fore), _mm_andnot_si128(bits, back));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(o_dest + i), blended);
+    }
+#endif
+
+    for (; i < byteCount; ++i) {
+      o_dest[i] = (mask[i] & foreground[i]) | (~mask[i] & background[i]);
+    }
+  }
+}
+
+SoftwareAsciiWindow::SoftwareAsciiWindow(void) :
+  SoftwareAsciiWindow(GetGlyphAtlas())
+{}
+
+SoftwareAsciiWindow::SoftwareAsciiWindow(std::shared_ptr<GlyphAtlas const> const & atlas) :
+  m_glyphSize(atlas->GetGlyphSize()),
+  m_glyphRowBytes(atlas->GetGlyphSize().x * sizeof(Color)),
+  m_glyphCount(atlas->GetGlyphCount())
+{
+  unsigned char const * const sheet      = atlas->GetGlyphSheet();
+  int const                   sheetWidth = c_glyphsPerRow * m_glyphSize.x;
+
+  m_glyphMasks.resize(size_t(m_glyphCount) * m_glyphSize.y * m_glyphRowBytes);
+
+  for (int glyph = 0; glyph < m_glyphCount; ++glyph) {
+    ivec2 const sheetPos = ivec2(glyph % c_glyphsPerRow, glyph / c_glyphsPerRow) * m_glyphSize;
+
+    for (int row = 0; row < m_glyphSize.y; ++row) {
+      unsigned char * const maskRow = m_glyphMasks.data() + (glyph * m_glyphSize.y + row) * m_glyphRowBytes;
+
+      for (int column = 0; column < m_glyphSize.x; ++column) {
+        bool const isSet = sheet[(sheetPos.y + row) * sheetWidth + sheetPos.x + column] != 0;
+
+        for (int channel = 0; channel < int(sizeof(Color)); ++channel) {
+          maskRow[column * sizeof(Color) + channel] = isSet ? 0xFF : 0x00;
+        }
+      }
+    }
+  }
+
+  EvaluatePalette(m_font, 0, m_palette);
+  BuildColorRows();
+}
+
+void SoftwareAsciiWindow::Draw(Grid<AsciiCell, 2> const & draw) {
+  int64_t const drawStartNs = GetRunNs();
+
+  PackCells(draw, m_packedGrid);
+  Rasterize(m_packedGrid);
+
+  EndDraw(drawStartNs);
+}
+
+void SoftwareAsciiWindow::DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) {
+  int64_t const drawStartNs = GetRunNs();
+
+  CompositeLayers(size, layers, m_compositedGrid);
+  PackCells(m_compositedGrid, m_packedGrid);
+  Rasterize(m_packedGrid);
+
+  EndDraw(drawStartNs);
+}
+
+void SoftwareAsciiWindow::DrawPacked(Grid<AsciiPackedCell, 2> const & draw) {
+  int64_t const drawStartNs = GetRunNs();
+
+  Rasterize(draw);
+
+  EndDraw(drawStartNs);
+}
+
+void SoftwareAsciiWindow::Rasterize(Grid<AsciiPackedCell, 2> const & draw) {
+  bool const isRecolored = UpdatePalette();
+
+  m_size = draw.GetSize();
+
+  if (m_rasterizedGrid.GetSize() != draw.GetSize()) {
+    m_framebuffer    = Grid<Color, 2>(draw.GetSize() * m_glyphSize);
+    m_rasterizedGrid = draw;
+
+    for (int i = 0; i < draw.Count(); ++i) {
+      RasterizeCell(i, draw.Data()[i]);
+    }
+
+    m_rasterizedCells = draw.Count();
+    return;
+  }
+
+  FindChangedCellSpans(m_rasterizedGrid.Data(), draw.Data(), draw.Count(), 0, m_changedSpans);
+
+  for (CellSpan const & span : m_changedSpans) {
+    for (int i = span.begin; i < span.end; ++i) {
+      RasterizeCell(i, draw.Data()[i]);
+
+      m_rasterizedGrid.Data()[i] = draw.Data()[i];
+    }
+  }
+
+  m_rasterizedCells = CountSpanCells(m_changedSpans);
+
+  // Cells that stayed the same still have to be redrawn if one of their colors changed. Changed
+  // cells were just drawn with the new palette, so the spans are skipped.
+  if (isRecolored) {
+    size_t nextSpan = 0;
+
+    for (int i = 0; i < m_rasterizedGrid.Count(); ++i) {
+      if (nextSpan < m_changedSpans.size() && i == m_changedSpans[nextSpan].begin) {
+        i = m_changedSpans[nextSpan++].end - 1;
+        continue;
+      }
+
+      AsciiPackedCell const & cell = m_rasterizedGrid.Data()[i];
+
+      if (m_changedColors[GetPaletteIndex(cell.GetForegroundColor())] || m_changedColors[GetPaletteIndex(cell.GetBackgroundColor())]) {
+        RasterizeCell(i, cell);
+        ++m_rasterizedCells;
+      }
+    }
+  }
+}
+
+void SoftwareAsciiWindow::EndDraw(int64_t drawStartNs) {
+  m_frameStats.Add(&AsciiFrameStats::drawNs, GetRunNs() - drawStartNs);
+  m_frameStats.Add(&AsciiFrameStats::uploadedCells, m_rasterizedCells);
+  m_frameStats.EndFrame(GetRunNs());
+}
+
+Grid<AsciiCell, 2> & SoftwareAsciiWindow::AcquireBackbuffer(void) {
+  if (m_backbuffer.GetSize() != m_size) {
+    m_backbuffer = Grid<AsciiCell, 2>(m_size);
+  }
+
+  return m_backbuffer;
+}
+
+std::vector<AsciiInputEvent> SoftwareAsciiWindow::PollInput(void) {
+  std::span<AsciiInputEvent const> const events = DrainInput();
+
+  return std::vector<AsciiInputEvent>(events.begin(), events.end());
+}
+
+std::span<AsciiInputEvent const> SoftwareAsciiWindow::DrainInput(void) {
+  int64_t const pollStartNs = GetRunNs();
+
+  // Swapping keeps both allocations alive, so steady state draining never allocates.
+  m_drainedInput.clear();
+  std::swap(m_drainedInput, m_pendingInput);
+
+  m_frameStats.Add(&AsciiFrameStats::pollNs, GetRunNs() - pollStartNs);
+  m_frameStats.Add(&AsciiFrameStats::inputEvents, int64_t(m_drainedInput.size()));
+
+  return m_drainedInput;
+}
+
+std::string SoftwareAsciiWindow::GetClipboard(void) const {
+  return m_clipboard;
+}
+
+void SoftwareAsciiWindow::SetClipboard(std::string const & clipboard) {
+  m_clipboard = clipboard;
+}
+
+std::string SoftwareAsciiWindow::GetTitle(void) const {
+  return m_title;
+}
+
+void SoftwareAsciiWindow::SetTitle(std::string const & title) {
+  m_title = title;
+}
+
+AsciiFont SoftwareAsciiWindow::GetFont(void) const {
+  return m_font;
+}
+
+void SoftwareAsciiWindow::SetFont(AsciiFont const & font) {
+  if (font == m_font) {
+    return;
+  }
+
+  // The next draw redraws just the cells whose colors changed.
+  m_font = font;
+}
+
+int SoftwareAsciiWindow::GetRunMs(void) const {
+  return int(m_runNs / c_nsPerMs);
+}
+
+void SoftwareAsciiWindow::Sleep(int milliseconds) {
+  AdvanceRunMs(milliseconds);
+}
+
+int64_t SoftwareAsciiWindow::GetRunUs(void) const {
+  return m_runNs / c_nsPerUs;
+}
+
+int64_t SoftwareAsciiWindow::GetRunNs(void) const {
+  return m_runNs;
+}
+
+void SoftwareAsciiWindow::SleepUntilNs(int64_t runNs) {
+  m_runNs = std::max(m_runNs, runNs);
+}
+
+FrameStatsRecorder const & SoftwareAsciiWindow::GetFrameStats(void) const {
+  return m_frameStats;
+}
+
+void SoftwareAsciiWindow::SetRunMs(int runMs) {
+  m_runNs = runMs * c_nsPerMs;
+}
+
+void SoftwareAsciiWindow::AdvanceRunMs(int milliseconds) {
+  if (milliseconds > 0) {
+    m_runNs += milliseconds * c_nsPerMs;
+  }
+}
+
+void SoftwareAsciiWindow::QueueInput(AsciiInputEvent const & event) {
+  m_pendingInput.emplace_back(event);
+}
+
+void SoftwareAsciiWindow::Resize(ivec2 const & size) {
+  if (size == m_size) {
+    return;
+  }
+
+  m_size = size;
+
+  AsciiInputEvent event;
+  event.type        = AsciiInputType::Resize;
+  event.resizeEvent = size;
+
+  QueueInput(event);
+}
+
+Grid<Color, 2> const & SoftwareAsciiWindow::GetFramebuffer(void) const {
+  return m_framebuffer;
+}
+
+int SoftwareAsciiWindow::GetRasterizedCells(void) const {
+  return m_rasterizedCells;
+}
+
+// Glyphs past the atlas's last page wrap around to its first, like they do on the GPU.
+void SoftwareAsciiWindow::RasterizeCell(int index, AsciiPackedCell const & cell) {
+  int const   gridWidth  = m_rasterizedGrid.GetSize().x;
+  int const   frameWidth = m_framebuffer.GetSize().x;
+  ivec2 const pixelPos   = ivec2(index % gridWidth, index / gridWidth) * m_glyphSize;
+
+  unsigned char const * mask       = m_glyphMasks.data() + (cell.GetGlyph() % m_glyphCount) * m_glyphSize.y * m_glyphRowBytes;
+  unsigned char const * foreground = m_colorRows.data() + GetPaletteIndex(cell.GetForegroundColor()) * m_glyphRowBytes;
+  unsigned char const * background = m_colorRows.data() + GetPaletteIndex(cell.GetBackgroundColor()) * m_glyphRowBytes;
+  unsigned char *       dest       = reinterpret_cast<unsigned char *>(m_framebuffer.Data() + pixelPos.y * frameWidth + pixelPos.x);
+
+  for (int row = 0; row < m_glyphSize.y; ++row) {
+    BlendRow(dest, foreground, background, mask, m_glyphRowBytes);
+
+    dest += frameWidth * sizeof(Color);
+    mask += m_glyphRowBytes;
+  }
+}
+
+bool SoftwareAsciiWindow::UpdatePalette(void) {
+  Color palette[PaletteColorCount];
+  EvaluatePalette(m_font, GetRunMs(), palette);
+
+  bool isChanged = false;
+
+  for (int i = 0; i < PaletteColorCount; ++i) {
+    m_changedColors[i] = !(palette[i] == m_palette[i]);
+    m_palette[i]       = palette[i];
+    isChanged         |= m_changedColors[i];
+  }
+
+  if (isChanged) {
+    BuildColorRows();
+  }
+
+  return isChanged;
+}
+
+void SoftwareAsciiWindow::BuildColorRows(void) {
+  m_colorRows.resize(size_t(PaletteColorCount) * m_glyphRowBytes);
+
+  for (int i = 0; i < PaletteColorCount; ++i) {
+    Color * const colorRow = reinterpret_cast<Color *>(m_colorRows.data() + i * m_glyphRowBytes);
+
+    for (int column = 0; column < m_glyphSize.x; ++column) {
+      colorRow[column] = m_palette[i];
+    }
+  }
+}
@@ -0,0 +1,413 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/TerminalWindow.h"
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#ifdef WIN32
+  #define WIN32_LEAN_AND_MEAN
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <Windows.h>
+#else
+  #include <cerrno>
+  #include <csignal>
+  #include <sys/ioctl.h>
+  #include <termios.h>
+  #include <unistd.h>
+#endif
+
+#include "Window/Layers.h"
+#include "Window/PackedCells.h"
+#include "Window/Palette.h"
+
+namespace {
+  // Alternate screen, hidden cursor, and mouse reports for every motion in SGR form.
+  char const c_enterSequence[] = "\x1b[?1049h\x1b[?25l\x1b[?1003h\x1b[?1006h";
+  char const c_leaveSequence[] = "\x1b[0m\x1b[?1006l\x1b[?1003l\x1b[?25h\x1b[?1049l";
+
+  int const c_readBufferSize = 256;
+
+#ifndef WIN32
+  // Set when the terminal is resized, so its size is only asked for after it changes.
+  volatile std::sig_atomic_t s_isResized = 0;
+
+  void HandleResize(int) {
+    s_isResized = 1;
+  }
+#endif
+
+  std::string EncodeBase64(std::string const & text) {
+    char const c_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string result;
+    result.reserve((text.size() + 2) / 3 * 4);
+
+    for (size_t i = 0; i < text.size(); i += 3) {
+      size_t const   remaining = text.size() - i;
+      uint32_t const bits      =
+        (uint32_t((unsigned char)(text[i])) << 16) |
+        (remaining > 1 ? uint32_t((unsigned char)(text[i + 1])) << 8 : 0) |
+        (remaining > 2 ? uint32_t((unsigned char)(text[i + 2])) : 0)
+      ;
+
+      result += c_alphabet[(bits >> 18) & 0x3F];
+      result += c_alphabet[(bits >> 12) & 0x3F];
+      result += remaining > 1 ? c_alphabet[(bits >> 6) & 0x3F] : '=';
+      result += remaining > 2 ? c_alphabet[bits & 0x3F] : '=';
+    }
+
+    return result;
+  }
+}
+
+struct TerminalAsciiWindow::Impl {
+#ifdef WIN32
+  HANDLE input              = INVALID_HANDLE_VALUE;
+  HANDLE output             = INVALID_HANDLE_VALUE;
+  DWORD  originalInputMode  = 0;
+  DWORD  originalOutputMode = 0;
+  UINT   originalCodePage   = 0;
+  bool   isResized          = false;
+#else
+  termios          originalMode;
+  struct sigaction originalResizeAction;
+#endif
+  bool isRaw = false;
+
+  std::chrono::steady_clock::time_point startTime;
+};
+
+TerminalAsciiWindow::TerminalAsciiWindow(void) :
+  m_impl(std::make_unique<Impl>())
+{
+  m_impl->startTime = std::chrono::steady_clock::now();
+
+#ifdef WIN32
+  m_impl->input  = GetStdHandle(STD_INPUT_HANDLE);
+  m_impl->output = GetStdHandle(STD_OUTPUT_HANDLE);
+
+  if (GetConsoleMode(m_impl->input, &m_impl->originalInputMode) && GetConsoleMode(m_impl->output, &m_impl->originalOutputMode)) {
+    m_impl->originalCodePage = GetConsoleOutputCP();
+    m_impl->isRaw            = true;
+
+    SetConsoleMode(m_impl->input, ENABLE_VIRTUAL_TERMINAL_INPUT | ENABLE_WINDOW_INPUT | ENABLE_EXTENDED_FLAGS);
+    SetConsoleMode(m_impl->output, m_impl->originalOutputMode | ENABLE_VIRTUAL_TERMINAL_PROCESSING | DISABLE_NEWLINE_AUTO_RETURN);
+    SetConsoleOutputCP(CP_UTF8);
+  }
+#else
+  if (tcgetattr(STDIN_FILENO, &m_impl->originalMode) == 0) {
+    termios raw = m_impl->originalMode;
+
+    // Control keys like ctrl+c arrive as input instead of signals, and reads never block.
+    raw.c_iflag    &= ~(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+    raw.c_oflag    &= ~(OPOST);
+    raw.c_cflag    |= CS8;
+    raw.c_lflag    &= ~(ECHO | ICANON | IEXTEN | ISIG);
+    raw.c_cc[VMIN]  = 0;
+    raw.c_cc[VTIME] = 0;
+
+    m_impl->isRaw = tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) == 0;
+  }
+
+  struct sigaction resizeAction = {};
+  resizeAction.sa_handler = HandleResize;
+  resizeAction.sa_flags   = SA_RESTART;
+  sigemptyset(&resizeAction.sa_mask);
+
+  sigaction(SIGWINCH, &resizeAction, &m_impl->originalResizeAction);
+#endif
+
+  m_terminalSize = GetTerminalSize();
+
+  Write(c_enterSequence);
+}
+
+TerminalAsciiWindow::~TerminalAsciiWindow(void) {
+  Write(c_leaveSequence);
+
+#ifndef WIN32
+  sigaction(SIGWINCH, &m_impl->originalResizeAction, nullptr);
+#endif
+
+  if (!m_impl->isRaw) {
+    return;
+  }
+
+#ifdef WIN32
+  SetConsoleMode(m_impl->input, m_impl->originalInputMode);
+  SetConsoleMode(m_impl->output, m_impl->originalOutputMode);
+  SetConsoleOutputCP(m_impl->originalCodePage);
+#else
+  tcsetattr(STDIN_FILENO, TCSAFLUSH, &m_impl->originalMode);
+#endif
+}
+
+void TerminalAsciiWindow::Draw(Grid<AsciiCell, 2> const & draw) {
+  Present(draw, GetRunNs());
+}
+
+void TerminalAsciiWindow::DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) {
+  int64_t const drawStartNs = GetRunNs();
+
+  CompositeLayers(size, layers, m_compositedGrid);
+
+  Present(m_compositedGrid, drawStartNs);
+}
+
+void TerminalAsciiWindow::DrawPacked(Grid<AsciiPackedCell, 2> const & draw) {
+  int64_t const drawStartNs = GetRunNs();
+
+  UnpackCells(draw, m_unpackedGrid);
+
+  Present(m_unpackedGrid, drawStartNs);
+}
+
+Grid<AsciiCell, 2> & TerminalAsciiWindow::AcquireBackbuffer(void) {
+  if (m_backbuffer.GetSize() != m_terminalSize) {
+    m_backbuffer = Grid<AsciiCell, 2>(m_terminalSize);
+  }
+
+  return m_backbuffer;
+}
+
+std::vector<AsciiInputEvent> TerminalAsciiWindow::PollInput(void) {
+  std::span<AsciiInputEvent const> const events = DrainInput();
+
+  return std::vector<AsciiInputEvent>(events.begin(), events.end());
+}
+
+std::span<AsciiInputEvent const> TerminalAsciiWindow::DrainInput(void) {
+  int64_t const pollStartNs = GetRunNs();
+
+  m_drainedInput.clear();
+
+  ReadInput();
+  std::swap(m_input, m_drainedInput);
+
+  m_frameStats.Add(&AsciiFrameStats::pollNs, GetRunNs() - pollStartNs);
+  m_frameStats.Add(&AsciiFrameStats::inputEvents, int64_t(m_drainedInput.size()));
+
+  return m_drainedInput;
+}
+
+std::string TerminalAsciiWindow::GetClipboard(void) const {
+  return m_clipboard;
+}
+
+void TerminalAsciiWindow::SetClipboard(std::string const & clipboard) {
+  m_clipboard = clipboard;
+
+  Write("\x1b]52;c;" + EncodeBase64(clipboard) + "\x07");
+}
+
+std::string TerminalAsciiWindow::GetTitle(void) const {
+  return m_title;
+}
+
+void TerminalAsciiWindow::SetTitle(std::string const & title) {
+  m_title = title;
+
+  Write("\x1b]2;" + title + "\x07");
+}
+
+AsciiFont TerminalAsciiWindow::GetFont(void) const {
+  return m_font;
+}
+
+void TerminalAsciiWindow::SetFont(AsciiFont const & font) {
+  if (font == m_font) {
+    return;
+  }
+
+  // Picked up by the next draw along with the palette's cycles.
+  m_font = font;
+}
+
+int TerminalAsciiWindow::GetRunMs(void) const {
+  return int(GetRunNs() / 1000000);
+}
+
+void TerminalAsciiWindow::Sleep(int milliseconds) {
+  SleepUntilNs(GetRunNs() + int64_t(milliseconds) * 1000000);
+}
+
+int64_t TerminalAsciiWindow::GetRunUs(void) const {
+  return GetRunNs() / 1000;
+}
+
+int64_t TerminalAsciiWindow::GetRunNs(void) const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_impl->startTime).count();
+}
+
+void TerminalAsciiWindow::SleepUntilNs(int64_t runNs) {
+  int64_t const sleepStartNs = GetRunNs();
+
+  std::this_thread::sleep_until(m_impl->startTime + std::chrono::nanoseconds(runNs));
+
+  m_frameStats.Add(&AsciiFrameStats::sleepNs, GetRunNs() - sleepStartNs);
+}
+
+FrameStatsRecorder const & TerminalAsciiWindow::GetFrameStats(void) const {
+  return m_frameStats;
+}
+
+ivec2 TerminalAsciiWindow::GetTerminalSize(void) const {
+#ifdef WIN32
+  CONSOLE_SCREEN_BUFFER_INFO info;
+  if (GetConsoleScreenBufferInfo(m_impl->output, &info)) {
+    return ivec2(info.srWindow.Right - info.srWindow.Left + 1, info.srWindow.Bottom - info.srWindow.Top + 1);
+  }
+#else
+  winsize size;
+  if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0) {
+    return ivec2(size.ws_col, size.ws_row);
+  }
+#endif
+
+  return ivec2(0, 0);
+}
+
+int64_t TerminalAsciiWindow::GetWrittenBytes(void) const {
+  return m_writtenBytes;
+}
+
+void TerminalAsciiWindow::ReadInput(void) {
+  char buffer[c_readBufferSize];
+  bool hasRead = false;
+
+#ifdef WIN32
+  DWORD pendingCount = 0;
+
+  while (GetNumberOfConsoleInputEvents(m_impl->input, &pendingCount) && pendingCount > 0) {
+    INPUT_RECORD records[64];
+    DWORD        readCount = 0;
+
+    if (!ReadConsoleInputA(m_impl->input, records, 64, &readCount)) {
+      break;
+    }
+
+    int count = 0;
+    for (DWORD i = 0; i < readCount; ++i) {
+      KEY_EVENT_RECORD const & key = records[i].Event.KeyEvent;
+
+      if (records[i].EventType == WINDOW_BUFFER_SIZE_EVENT) {
+        m_impl->isResized = true;
+      }
+
+      if (records[i].EventType != KEY_EVENT || !key.bKeyDown || key.uChar.AsciiChar == 0) {
+        continue;
+      }
+
+      for (WORD repeat = 0; repeat < key.wRepeatCount && count < c_readBufferSize; ++repeat) {
+        buffer[count++] = key.uChar.AsciiChar;
+      }
+    }
+
+    if (count > 0) {
+      m_parser.Parse(buffer, count, m_input);
+      hasRead = true;
+    }
+  }
+#else
+  for (;;) {
+    ssize_t const count = read(STDIN_FILENO, buffer, sizeof(buffer));
+
+    if (count <= 0) {
+      break;
+    }
+
+    m_parser.Parse(buffer, int(count), m_input);
+    hasRead = true;
+  }
+#endif
+
+  // Nothing followed a held back escape, so it was the key rather than the start of a sequence.
+  if (!hasRead) {
+    m_parser.Flush(m_input);
+  }
+
+  CheckResize();
+}
+
+void TerminalAsciiWindow::CheckResize(void) {
+#ifdef WIN32
+  bool const isResized = std::exchange(m_impl->isResized, false);
+#else
+  bool const isResized = s_isResized != 0;
+  s_isResized = 0;
+#endif
+
+  if (!isResized) {
+    return;
+  }
+
+  ivec2 const terminalSize = GetTerminalSize();
+  if (terminalSize == m_terminalSize) {
+    return;
+  }
+
+  // A resized terminal may have reflowed or cleared what was on it.
+  m_terminalSize = terminalSize;
+  m_encoder.Invalidate();
+
+  AsciiInputEvent event;
+  event.type        = AsciiInputType::Resize;
+  event.resizeEvent = terminalSize;
+
+  m_input.push_back(event);
+}
+
+void TerminalAsciiWindow::Present(Grid<AsciiCell, 2> const & draw, int64_t drawStartNs) {
+  CheckResize();
+
+  Color palette[PaletteColorCount];
+  EvaluatePalette(m_font, GetRunMs(), palette);
+  m_encoder.SetPalette(palette);
+
+  m_output.clear();
+  m_encoder.Encode(draw, m_output);
+
+  int64_t const writeStartNs = GetRunNs();
+
+  Write(m_output);
+
+  int64_t const writeEndNs = GetRunNs();
+
+  m_frameStats.Add(&AsciiFrameStats::drawNs, writeStartNs - drawStartNs);
+  m_frameStats.Add(&AsciiFrameStats::swapNs, writeEndNs - writeStartNs);
+  m_frameStats.Add(&AsciiFrameStats::uploadedCells, m_encoder.GetWrittenCells());
+  m_frameStats.EndFrame(writeEndNs);
+}
+
+void TerminalAsciiWindow::Write(std::string const & bytes) {
+  char const * write     = bytes.data();
+  size_t       remaining = bytes.size();
+
+  while (remaining > 0) {
+#ifdef WIN32
+    DWORD written = 0;
+    if (!WriteFile(m_impl->output, write, DWORD(remaining), &written, nullptr)) {
+      break;
+    }
+#else
+    ssize_t const written = ::write(STDOUT_FILENO, write, remaining);
+    if (written < 0) {
+      if (errno == EINTR || errno == EAGAIN) {
+        continue;
+      }
+      break;
+    }
+#endif
+
+    write     += written;
+    remaining -= size_t(written);
+  }
+
+  m_writtenBytes += int64_t(bytes.size() - remaining);
+}
@@ -4,6 +4,11 @@
 
 #include "Window/Window.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
 #ifdef WIN32
   #define _WIN32_TINNT 0x500
   #define WIN32_LEAN_AND_MEAN
@@ -14,8 +19,14 @@
 #endif
 
 #include "glad.h"
+#include "Containers/SpscQueue.h"
+#include "Containers/TripleBuffer.h"
 #include "GLFW/glfw3.h"
 #include "Window/BlockFont.h"
+#include "Window/CaptureWriter.h"
+#include "Window/CellDiff.h"
+#include "Window/GlyphAtlas.h"
+#include "Window/Palette.h"
 
 namespace {
 
@@ -141,13 +152,79 @@ namespace {
   };
   static_assert(int(AsciiState::Count) == 6);
 
-  static std::vector<AsciiInputEvent> s_pollingInput;
+  static const int c_inputQueueCapacity = 1024;
+
+  static const int64_t c_nsPerUs     = 1000;
+  static const int64_t c_nsPerMs     = 1000000;
+  static const int64_t c_nsPerSecond = 1000000000;
+  static const int64_t c_sleepSpinNs = 2000000;
+
+  // Filled by the GLFW callbacks and emptied by DrainInput. Events arriving while it's full are
+  // dropped.
+  static SpscQueue<AsciiInputEvent, c_inputQueueCapacity> s_inputQueue;
+
+  static int s_glCallCount = 0;
 
   static const int c_defaultWindowWidth  = 640 * 2;
   static const int c_defaultWindowHeight = 360 * 2;
 
   static const int c_errorMesageBufferSize = 0x1 << 10;
 
+  static const int c_uploadSpanMergeDistance = 16;
+  static const int c_maxUploadSpans          = 64;
+
+  static const int      c_ringSegmentCount      = 3;
+  static const GLuint64 c_fenceWaitTimeoutNs    = 1000000;
+  static const int      c_ringBufferAccessFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  // Frames in flight between glReadPixels and the callback. Readback usually lands 1 or 2 frames
+  // late, so this leaves headroom before anything is dropped.
+  static const int c_captureSlotCount = 4;
+
+  // Looks up a cell color with the layer's bank and the font's cycles applied. Cycles are
+  // first, count, stepMs and isSmooth, and the first one covering a color wins.
+  static char const * const c_paletteShaderSource = R"(
+    uniform vec3  colorPalette[32];
+    uniform ivec4 paletteCycles[4];
+    uniform int   paletteTimeMs;
+    uniform int   layerPaletteBank;
+
+    vec3 GetPaletteColor(int colorIndex) {
+      colorIndex = (colorIndex + layerPaletteBank * 8) % 32;
+
+      for (int i = 0; i < 4; ++i) {
+        ivec4 cycle = paletteCycles[i];
+        int   slot  = colorIndex - cycle.x;
+
+        if (slot >= 0 && slot < cycle.y) {
+          int  steps = paletteTimeMs / cycle.z;
+          vec3 from  = colorPalette[cycle.x + (slot + steps) % cycle.y];
+          vec3 to    = colorPalette[cycle.x + (slot + steps + 1) % cycle.y];
+
+          return cycle.w != 0 ? mix(from, to, float(paletteTimeMs % cycle.z) / float(cycle.z)) : from;
+        }
+      }
+
+      return colorPalette[colorIndex];
+    }
+  )";
+  static_assert(PaletteColorCount == 32 && PaletteCycleCount == 4 && FontColorCount == 8);
+
+  // Packed cells reach the shaders as the words they're stored as and are split up here, so the
+  // CPU never converts them.
+  static char const * const c_cellShaderSource = R"(
+    uniform bool isPackedCells;
+
+    int GetTransparentColor() {
+      return isPackedCells ? 2047 : 255;
+    }
+
+    ivec3 UnpackCell(uint cell) {
+      return ivec3(int(cell & 0x3FFu), int((cell >> 10) & 0x7FFu), int(cell >> 21));
+    }
+  )";
+  static_assert(PackedGlyphCount == 1024 && PackedColorCount == 2048 && PackedTransparentColor == 2047 && TransparentColor == 255);
+
   int GetGlfwModFromAsciiState(AsciiState state) {
     switch (state) {
       case AsciiState::CapsLock:    return GLFW_MOD_CAPS_LOCK;
@@ -278,6 +355,43 @@ namespace {
 
   void nop() {}
 
+  // Everything the render thread needs to draw a frame without reading state the caller may change.
+  // Packed frames are a single grid in packedCells instead of layers.
+  struct RenderFrame {
+    ivec2                           size;
+    std::vector<Grid<AsciiCell, 2>> layers;
+    std::vector<ivec2>              offsets;
+    std::vector<int>                paletteBanks;
+    Grid<AsciiPackedCell, 2>        packedCells;
+    bool                            isPacked   = false;
+    AsciiFont                       font;
+    int64_t                         runNs      = 0;
+    AsciiStreamMode                 streamMode = AsciiStreamMode::BufferUpdate;
+  };
+
+  // The GPU copy of one layer, along with what was last uploaded to it so only changes are sent.
+  // Only the grid of the format last uploaded holds anything, so switching formats sends everything.
+  struct LayerBuffer {
+    GLuint                   vertexBuffer = GL_INVALID_INDEX;
+    GLuint                   cellTexture  = GL_INVALID_INDEX;
+    Grid<AsciiCell, 2>       submittedGrid;
+    Grid<AsciiPackedCell, 2> submittedPackedGrid;
+  };
+
+  // A pixel buffer a frame is read back into, and which frame it holds until its fence passes.
+  struct CaptureSlot {
+    GLuint  pixelBuffer = GL_INVALID_INDEX;
+    int     bufferBytes = 0;
+    GLsync  fence       = nullptr;
+    ivec2   size;
+    int64_t frameIndex  = 0;
+    int64_t runNs       = 0;
+  };
+
+  void CountGlCall(void const *, char const *) {
+    ++s_glCallCount;
+  }
+
   void CheckGlError(void const * func, char const * name) {
     if (func != glad_glGetError) {
       GLint errorCode = glGetError();
@@ -302,6 +416,30 @@ namespace {
     }
   }
 
+  GLuint CompileShader(GLenum type, std::initializer_list<char const *> sources) {
+    GLuint const shader = glCreateShader(type);
+    glShaderSource(shader, GLsizei(sources.size()), sources.begin(), nullptr);
+    glCompileShader(shader);
+    CheckGlShaderError(shader);
+
+    return shader;
+  }
+
+  bool IsPersistentMappingSupported(void) {
+    return GLAD_GL_ARB_buffer_storage && glad_glBufferStorage && glad_glFenceSync;
+  }
+
+  void WaitForFence(GLsync & io_fence) {
+    if (!io_fence) {
+      return;
+    }
+
+    while (glClientWaitSync(io_fence, GL_SYNC_FLUSH_COMMANDS_BIT, c_fenceWaitTimeoutNs) == GL_TIMEOUT_EXPIRED) {}
+
+    glDeleteSync(io_fence);
+    io_fence = nullptr;
+  }
+
   void CheckGlShaderProgramError(GLuint program) {
     GLint status;
     glGetProgramiv(program, GL_LINK_STATUS, &status);
@@ -336,7 +474,7 @@ struct AsciiWindow::Impl {
           newStateEvent.stateEvent.state = state;
 
           impl->currentState[i] = isActive;
-          s_pollingInput.emplace_back(newStateEvent);
+          s_inputQueue.TryPush(newStateEvent);
         }
       }
 
@@ -354,7 +492,7 @@ struct AsciiWindow::Impl {
     event.buttonEvent.isDown = (action != GLFW_RELEASE);
     event.buttonEvent.button = GetButtonFromGlfwKey(key);
 
-    s_pollingInput.emplace_back(event);
+    s_inputQueue.TryPush(event);
   }
 
   static void MouseButtonCallback(GLFWwindow * window, int button, int action, int mods) {
@@ -367,7 +505,7 @@ struct AsciiWindow::Impl {
     event.buttonEvent.isDown = (action != GLFW_RELEASE);
     event.buttonEvent.button = GetButtonFromGlfwMouseButton(button);
 
-    s_pollingInput.emplace_back(event);
+    s_inputQueue.TryPush(event);
   }
 
   static void MouseScrollCallback(GLFWwindow * window, double xoffset, double yoffset) {
@@ -376,7 +514,7 @@ struct AsciiWindow::Impl {
     event.type             = AsciiInputType::MouseScroll;
     event.mouseScrollEvent = int(yoffset);
 
-    s_pollingInput.emplace_back(event);
+    s_inputQueue.TryPush(event);
   }
 
   static void MousePositionCallback(GLFWwindow * window, double xpos, double ypos) {
@@ -396,7 +534,33 @@ struct AsciiWindow::Impl {
 
     event.mousePositionEvent = ivec2(xCoord, yCoord);
 
-    s_pollingInput.emplace_back(event);
+    s_inputQueue.TryPush(event);
+  }
+
+  // Sizes set by Draw already match, so only resizes from outside the game are reported.
+  static void WindowSizeCallback(GLFWwindow * window, int width, int height) {
+    Impl * impl = reinterpret_cast<Impl *>(glfwGetWindowUserPointer(window));
+
+    ivec2 const size = impl->GetCellsForPixels(ivec2(width, height));
+
+    if (size == impl->size) {
+      return;
+    }
+
+    impl->size = size;
+
+    AsciiInputEvent event;
+
+    event.type        = AsciiInputType::Resize;
+    event.resizeEvent = size;
+
+    s_inputQueue.TryPush(event);
+  }
+
+  ivec2 GetCellsForPixels(ivec2 const & pixels) const {
+    ivec2 const glyphSize = windowGlyphSize == ivec2(0, 0) ? GetGlyphSize() : windowGlyphSize;
+
+    return ivec2(std::max(1, pixels.x / glyphSize.x), std::max(1, pixels.y / glyphSize.y));
   }
 
   static void SetImpl(std::shared_ptr<Impl> const & impl) {
@@ -413,16 +577,10 @@ struct AsciiWindow::Impl {
       glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
       glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
       glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-      glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+      glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
 
       impl->window = glfwCreateWindow(c_defaultWindowWidth, c_defaultWindowHeight, "", nullptr, nullptr);
-      glfwMakeContextCurrent(impl->window);
-
-      // Must happen after creating our context current.
-      gladLoadGLLoader(GLADloadproc(glfwGetProcAddress));
-
-      // Enable to solve graphics weirdness. Turns out glGetError is expensive.
-      //gladSetPostGlCallCallback(CheckGlError);
+      impl->size   = impl->GetCellsForPixels(ivec2(c_defaultWindowWidth, c_defaultWindowHeight));
 
       glfwSetWindowUserPointer(impl->window, impl.get());
 
@@ -432,19 +590,160 @@ struct AsciiWindow::Impl {
       glfwSetMouseButtonCallback(impl->window, Impl::MouseButtonCallback);
       glfwSetScrollCallback(impl->window, Impl::MouseScrollCallback);
       glfwSetCursorPosCallback(impl->window, Impl::MousePositionCallback);
+      glfwSetWindowSizeCallback(impl->window, Impl::WindowSizeCallback);
+
+      if (impl->threadMode == AsciiThreadMode::RenderThread) {
+        impl->StartRenderThread();
+      }
+      else {
+        glfwMakeContextCurrent(impl->window);
+        impl->InitializeGl();
+      }
+    }
+  }
+
+  // Must run on the thread that owns the context.
+  void InitializeGl(void) {
+    // Must happen after creating our context current.
+    gladLoadGLLoader(GLADloadproc(glfwGetProcAddress));
+
+    gladSetPostGlCallCallback(CountGlCall);
+
+    // Enable to solve graphics weirdness. Turns out glGetError is expensive.
+    //gladSetPostGlCallCallback(CheckGlError);
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
 
-      glGenVertexArrays(1, &impl->vao);
-      glBindVertexArray(impl->vao);
+    // Fragment shaders get the version, the palette lookup and the cell unpacking put in front of
+    // them. Vertex shaders that read cells get the version and the cell unpacking.
+    char const * fragShaderSource = R"(
+      uniform isampler2DRect fontSheet;
 
+      in Data {
+        vec2       texelPos;
+        flat ivec2 colorIndices;
+      } inData;
+
+      out vec4 outColor;
+
+      void main() {
+        bool shouldDraw = texture(fontSheet, inData.texelPos)[0] > 0;
+        //bool shouldDraw = bool(int(inData.texelPos.x + inData.texelPos.y) % 2);
+        int  colorIndex = inData.colorIndices[shouldDraw ? 0 : 1];
+
+        // Transparent, so whatever the layers below drew stays.
+        if (colorIndex == GetTransparentColor()) {
+          discard;
+        }
+
+        outColor = vec4(GetPaletteColor(colorIndex), 1.0);
+        //outColor        = vec4(inData.texelPos.y / 100, inData.texelPos.y / 100, inData.texelPos.y / 100, 1.0);
+      }
+    )";
+
+    shader = glCreateProgram();
+
+    if (renderMode == AsciiRenderMode::CellTexture) {
+      // A single triangle covers the viewport and each fragment looks up its own cell, so there is
+      // no per cell vertex work at all. Each layer gets a viewport around just its own cells.
       char const * vertShaderSource = R"(
         #version 330
 
+        void main() {
+          vec2 pos = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+
+          gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+        }
+      )";
+
+      fragShaderSource = R"(
+        uniform ivec2          gridSize;
+        uniform ivec2          glyphSize;
+        uniform ivec2          fontSheetSize;
+        uniform isampler2DRect fontSheet;
+        uniform usampler2DRect cellGrid;
+        uniform ivec2          layerOffset;
+
+        out vec4 outColor;
+
+        void main() {
+          ivec2 pixel = ivec2(gl_FragCoord.xy);
+          pixel.y     = gridSize.y * glyphSize.y - 1 - pixel.y;
+
+          ivec2 cellPos = pixel / glyphSize;
+          uvec3 texel   = texelFetch(cellGrid, cellPos - layerOffset).rgb;
+          ivec3 cell    = isPackedCells ? UnpackCell(texel.r) : ivec3(texel);
+          int   glyph   = cell.x % (fontSheetSize.x * fontSheetSize.y);
+
+          ivec2 characterPos = ivec2(glyph % fontSheetSize.x, glyph / fontSheetSize.x);
+          ivec2 texelPos     = characterPos * glyphSize + pixel - cellPos * glyphSize;
+
+          bool shouldDraw = texture(fontSheet, vec2(texelPos) + 0.5)[0] > 0;
+          int  colorIndex = shouldDraw ? cell.y : cell.z;
+
+          // Transparent, so whatever the layers below drew stays.
+          if (colorIndex == GetTransparentColor()) {
+            discard;
+          }
+
+          outColor = vec4(GetPaletteColor(colorIndex), 1.0);
+        }
+      )";
+
+      glAttachShader(shader, CompileShader(GL_VERTEX_SHADER, { vertShaderSource }));
+    }
+    else if (renderMode == AsciiRenderMode::InstancedQuads) {
+      // One instance per cell. The quad corner comes from the vertex id of a 4 vertex strip.
+      char const * vertShaderSource = R"(
         uniform ivec2 gridSize;
         uniform ivec2 glyphSize;
         uniform ivec2 fontSheetSize;
+        uniform ivec2 layerOffset;
+        uniform ivec2 layerSize;
 
         in int   dispChar;
         in ivec2 colorIndices;
+        in uint  packedCell;
+
+        out Data {
+          vec2       texelPos;
+          flat ivec2 colorIndices;
+        } outData;
+
+        void main() {
+          ivec2 corner = ivec2(gl_VertexID & 1, gl_VertexID >> 1);
+          ivec2 pos    = layerOffset + ivec2(gl_InstanceID % layerSize.x, gl_InstanceID / layerSize.x) + corner;
+
+          gl_Position = vec4(
+            (float( 2 * pos.x) / float(gridSize.x)) - 1.0,
+            (float(-2 * pos.y) / float(gridSize.y)) + 1.0,
+            0.0,
+            1.0
+          );
+
+          ivec3 cell  = isPackedCells ? UnpackCell(packedCell) : ivec3(dispChar, colorIndices);
+          int   glyph = cell.x % (fontSheetSize.x * fontSheetSize.y);
+
+          ivec2 characterPos   = ivec2(glyph % fontSheetSize.x, glyph / fontSheetSize.x);
+          outData.texelPos     = vec2(glyphSize * (characterPos + corner));
+          outData.colorIndices = cell.yz;
+        }
+      )";
+
+      glAttachShader(shader, CompileShader(GL_VERTEX_SHADER, { "#version 330\n", c_cellShaderSource, vertShaderSource }));
+    }
+    else {
+      char const * vertShaderSource = R"(
+        uniform ivec2 gridSize;
+        uniform ivec2 glyphSize;
+        uniform ivec2 fontSheetSize;
+        uniform ivec2 layerOffset;
+        uniform ivec2 layerSize;
+
+        in int   dispChar;
+        in ivec2 colorIndices;
+        in uint  packedCell;
 
         out Data {
           vec2       glyphCenter;
@@ -452,7 +751,7 @@ struct AsciiWindow::Impl {
         } outData;
 
         void main() {
-          ivec2 pos = ivec2(gl_VertexID % gridSize.x, gl_VertexID / gridSize.x);
+          ivec2 pos = layerOffset + ivec2(gl_VertexID % layerSize.x, gl_VertexID / layerSize.x);
 
           gl_Position = vec4(
             (float( 2 * pos.x + 1) / float(gridSize.x)) - 1.0,
@@ -461,9 +760,12 @@ struct AsciiWindow::Impl {
             1.0
           );
 
-          ivec2 characterPos = ivec2(dispChar % fontSheetSize.x, dispChar / fontSheetSize.x);
+          ivec3 cell  = isPackedCells ? UnpackCell(packedCell) : ivec3(dispChar, colorIndices);
+          int   glyph = cell.x % (fontSheetSize.x * fontSheetSize.y);
+
+          ivec2 characterPos   = ivec2(glyph % fontSheetSize.x, glyph / fontSheetSize.x);
           outData.glyphCenter  = glyphSize * (characterPos + 0.5);
-          outData.colorIndices = colorIndices;
+          outData.colorIndices = cell.yz;
         }
       )";
 
@@ -519,81 +821,503 @@ struct AsciiWindow::Impl {
         }
       )";
 
-      char const * fragShaderSource = R"(
-        #version 330
+      glAttachShader(shader, CompileShader(GL_VERTEX_SHADER, { "#version 330\n", c_cellShaderSource, vertShaderSource }));
+      glAttachShader(shader, CompileShader(GL_GEOMETRY_SHADER, { geoShaderSource }));
+    }
 
-        uniform vec3           colorPalette[8];
-        uniform isampler2DRect fontSheet;
+    glAttachShader(shader, CompileShader(GL_FRAGMENT_SHADER, { "#version 330\n", c_paletteShaderSource, c_cellShaderSource, fragShaderSource }));
+    glLinkProgram(shader);
 
-        in Data {
-          vec2       texelPos;
-          flat ivec2 colorIndices;
-        } inData;
+    glUseProgram(shader);
+    CheckGlShaderProgramError(shader);
 
-        out vec4 outColor;
+    // Filled in by the first frame, which sees there is no glyph atlas uploaded yet.
+    GLuint fontSheet;
+    glGenTextures(1, &fontSheet);
+    glBindTexture(GL_TEXTURE_RECTANGLE, fontSheet);
 
-        void main() {
-          vec3 backgroundColor = colorPalette[inData.colorIndices[1]];
-          vec3 foregroundColor = colorPalette[inData.colorIndices[0]];
-          vec3 colorDiff       = foregroundColor - backgroundColor;
-
-          bool shouldDraw = texture(fontSheet, inData.texelPos)[0] > 0;
-          //bool shouldDraw = bool(int(inData.texelPos.x + inData.texelPos.y) % 2);
-          outColor        = vec4(float(shouldDraw) * colorDiff + backgroundColor, 1.0);
-          //outColor        = vec4(inData.texelPos.y / 100, inData.texelPos.y / 100, inData.texelPos.y / 100, 1.0);
+    glBindFragDataLocation(shader, 0, "outColor");
+
+    // Captured pixels are 3 bytes, so their rows are rarely 4 byte aligned either.
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    if (renderMode == AsciiRenderMode::CellTexture) {
+      // AsciiCells are 3 bytes, so rows of the cell texture are rarely 4 byte aligned.
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+      // Left as the active unit so cell uploads go straight to the layer's texture.
+      glActiveTexture(GL_TEXTURE1);
+
+      glUniform1i(glGetUniformLocation(shader, "cellGrid"), 1);
+    }
+    else {
+      charAttr = glGetAttribLocation(shader, "dispChar");
+      glEnableVertexAttribArray(charAttr);
+
+      colorAttr = glGetAttribLocation(shader, "colorIndices");
+      glEnableVertexAttribArray(colorAttr);
+
+      // Enabled in place of the others while drawing packed cells.
+      packedAttr = glGetAttribLocation(shader, "packedCell");
+
+      if (renderMode == AsciiRenderMode::InstancedQuads) {
+        glVertexAttribDivisor(charAttr, 1);
+        glVertexAttribDivisor(colorAttr, 1);
+        glVertexAttribDivisor(packedAttr, 1);
+      }
+    }
+
+    gridSizeUniform      = glGetUniformLocation(shader, "gridSize");
+    glyphSizeUniform     = glGetUniformLocation(shader, "glyphSize");
+    fontSheetSizeUniform = glGetUniformLocation(shader, "fontSheetSize");
+    colorPaletteUniform  = glGetUniformLocation(shader, "colorPalette");
+    paletteCyclesUniform = glGetUniformLocation(shader, "paletteCycles");
+    paletteTimeUniform   = glGetUniformLocation(shader, "paletteTimeMs");
+    paletteBankUniform   = glGetUniformLocation(shader, "layerPaletteBank");
+    fontSheetUniform     = glGetUniformLocation(shader, "fontSheet");
+    layerOffsetUniform   = glGetUniformLocation(shader, "layerOffset");
+    layerSizeUniform     = glGetUniformLocation(shader, "layerSize");
+    isPackedCellsUniform = glGetUniformLocation(shader, "isPackedCells");
+  }
+
+  // The font sheet stays bound to unit 0, which is only left active outside CellTexture mode.
+  void UploadGlyphAtlas(std::shared_ptr<GlyphAtlas const> const & atlas) {
+    ivec2 const glyphSize = atlas->GetGlyphSize();
+
+    if (renderMode == AsciiRenderMode::CellTexture) {
+      glActiveTexture(GL_TEXTURE0);
+    }
+
+    // Pages are stacked below each other, so the sheet just gets taller.
+    ivec2 const sheetGlyphs = ivec2(16, 16 * atlas->GetPageCount());
+
+    glTexImage2D(GL_TEXTURE_RECTANGLE, 0, GL_R8, sheetGlyphs.x * glyphSize.x, sheetGlyphs.y * glyphSize.y, 0, GL_RED, GL_UNSIGNED_BYTE, atlas->GetGlyphSheet());
+
+    if (renderMode == AsciiRenderMode::CellTexture) {
+      glActiveTexture(GL_TEXTURE1);
+    }
+
+    glUniform2i(glyphSizeUniform, glyphSize.x, glyphSize.y);
+    glUniform2i(fontSheetSizeUniform, sheetGlyphs.x, sheetGlyphs.y);
+
+    renderedAtlas = atlas;
+  }
+
+  void BindArrayBuffer(GLuint buffer) {
+    if (buffer != boundArrayBuffer) {
+      glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+      boundArrayBuffer = buffer;
+    }
+  }
+
+  void BindCellTexture(GLuint texture) {
+    if (texture != boundCellTexture) {
+      glBindTexture(GL_TEXTURE_RECTANGLE, texture);
+
+      boundCellTexture = texture;
+    }
+  }
+
+  void SetViewport(ivec2 const & origin, ivec2 const & size) {
+    if (origin != viewportOrigin || size != viewportSize) {
+      glViewport(origin.x, origin.y, size.x, size.y);
+
+      viewportOrigin = origin;
+      viewportSize   = size;
+    }
+  }
+
+  void SetLayerUniforms(ivec2 const & offset, ivec2 const & size, int paletteBank) {
+    if (offset != renderedLayerOffset) {
+      glUniform2i(layerOffsetUniform, offset.x, offset.y);
+
+      renderedLayerOffset = offset;
+    }
+
+    if (size != renderedLayerSize) {
+      glUniform2i(layerSizeUniform, size.x, size.y);
+
+      renderedLayerSize = size;
+    }
+
+    if (paletteBank != renderedPaletteBank) {
+      glUniform1i(paletteBankUniform, paletteBank);
+
+      renderedPaletteBank = paletteBank;
+    }
+  }
+
+  // Buffers are only created once a frame uses that many layers.
+  LayerBuffer & GetLayerBuffer(int index) {
+    if (index >= int(layerBuffers.size())) {
+      layerBuffers.resize(index + 1);
+    }
+
+    LayerBuffer & layer = layerBuffers[index];
+
+    if (renderMode == AsciiRenderMode::CellTexture) {
+      if (layer.cellTexture == GL_INVALID_INDEX) {
+        glGenTextures(1, &layer.cellTexture);
+        BindCellTexture(layer.cellTexture);
+        glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      }
+    }
+    else if (layer.vertexBuffer == GL_INVALID_INDEX) {
+      glGenBuffers(1, &layer.vertexBuffer);
+    }
+
+    return layer;
+  }
+
+  // Switches the shaders, and outside CellTexture mode the attributes they read, between the two
+  // cell formats.
+  void SetCellFormat(bool isPacked) {
+    if (isPacked == isRenderingPacked) {
+      return;
+    }
+
+    glUniform1i(isPackedCellsUniform, isPacked ? 1 : 0);
+
+    if (renderMode != AsciiRenderMode::CellTexture) {
+      if (isPacked) {
+        glDisableVertexAttribArray(charAttr);
+        glDisableVertexAttribArray(colorAttr);
+        glEnableVertexAttribArray(packedAttr);
+      }
+      else {
+        glDisableVertexAttribArray(packedAttr);
+        glEnableVertexAttribArray(charAttr);
+        glEnableVertexAttribArray(colorAttr);
+      }
+
+      // The newly enabled attributes haven't been pointed at anything yet.
+      attributeBuffer = GL_INVALID_INDEX;
+    }
+
+    isRenderingPacked = isPacked;
+  }
+
+  // The vertex array remembers the buffer along with the pointers, so this only needs to rerun when
+  // either changes.
+  template <typename Cell>
+  void SetCellAttributes(GLintptr offset) {
+    if (offset == attributeOffset && boundArrayBuffer == attributeBuffer) {
+      return;
+    }
+
+    attributeOffset = offset;
+    attributeBuffer = boundArrayBuffer;
+
+    Cell const * const cells = reinterpret_cast<Cell const *>(offset);
+
+    if constexpr (std::is_same_v<Cell, AsciiPackedCell>) {
+      glVertexAttribIPointer(packedAttr, 1, GL_UNSIGNED_INT, sizeof(AsciiPackedCell), &cells->bits);
+    }
+    else {
+      glVertexAttribIPointer(charAttr, 1, GL_UNSIGNED_BYTE, sizeof(AsciiCell), &cells->character);
+      glVertexAttribIPointer(colorAttr, 2, GL_UNSIGNED_BYTE, sizeof(AsciiCell), &cells->foregroundColor);
+    }
+  }
+
+  void ReleaseRingBuffer(void) {
+    if (ringBuffer == GL_INVALID_INDEX) {
+      return;
+    }
+
+    for (GLsync & fence : ringFences) {
+      WaitForFence(fence);
+    }
+
+    BindArrayBuffer(ringBuffer);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glDeleteBuffers(1, &ringBuffer);
+
+    // Deleting the bound buffer unbinds it. The name may also be reused by the next ring buffer.
+    boundArrayBuffer = 0;
+    attributeBuffer  = GL_INVALID_INDEX;
+
+    ringBuffer       = GL_INVALID_INDEX;
+    ringData         = nullptr;
+    ringSegmentBytes = 0;
+  }
+
+  void ReserveRingBuffer(int bytes) {
+    if (bytes <= ringSegmentBytes) {
+      return;
+    }
+
+    ReleaseRingBuffer();
+
+    // Rounded up so every segment starts where packed cells are aligned.
+    ringSegmentBytes = (bytes + int(sizeof(AsciiPackedCell)) - 1) & ~(int(sizeof(AsciiPackedCell)) - 1);
+
+    GLsizeiptr const ringBytes = GLsizeiptr(ringSegmentBytes) * c_ringSegmentCount;
+
+    glGenBuffers(1, &ringBuffer);
+    BindArrayBuffer(ringBuffer);
+    glBufferStorage(GL_ARRAY_BUFFER, ringBytes, nullptr, c_ringBufferAccessFlags);
+
+    ringData = reinterpret_cast<unsigned char *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, ringBytes, c_ringBufferAccessFlags));
+  }
+
+  // Starts reading back the frame just drawn. Must run before the buffers are swapped.
+  void CaptureFrame(ivec2 const & pixelSize, int64_t runNs) {
+    DeliverCaptures(false);
+
+    int64_t const frameIndex = capturedFrameIndex++;
+
+    if (capturePending == c_captureSlotCount) {
+      ++droppedCaptureFrames;
+      return;
+    }
+
+    CaptureSlot & slot  = captureSlots[(captureHead + capturePending) % c_captureSlotCount];
+    int const     bytes = pixelSize.x * pixelSize.y * int(sizeof(Color));
+
+    if (slot.pixelBuffer == GL_INVALID_INDEX) {
+      glGenBuffers(1, &slot.pixelBuffer);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixelBuffer);
+
+    if (bytes != slot.bufferBytes) {
+      glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+
+      slot.bufferBytes = bytes;
+    }
+
+    // With a pack buffer bound this only queues the copy, so nothing waits on the GPU here.
+    glReadPixels(0, 0, pixelSize.x, pixelSize.y, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence      = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.size       = pixelSize;
+    slot.frameIndex = frameIndex;
+    slot.runNs      = runNs;
+
+    ++capturePending;
+  }
+
+  // Hands finished captures to the callback, oldest first. Unless shouldWait, stops at the first
+  // one the GPU hasn't finished copying.
+  void DeliverCaptures(bool shouldWait) {
+    while (capturePending > 0) {
+      CaptureSlot & slot = captureSlots[captureHead];
+
+      if (shouldWait) {
+        WaitForFence(slot.fence);
+      }
+      else {
+        if (glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED) {
+          break;
         }
-      )";
 
-      GLuint vertShader = glCreateShader(GL_VERTEX_SHADER);
-      glShaderSource(vertShader, 1, &vertShaderSource, nullptr);
-      glCompileShader(vertShader);
-      CheckGlShaderError(vertShader);
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+      }
+
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixelBuffer);
 
-      GLuint fragShader = glCreateShader(GL_FRAGMENT_SHADER);
-      glShaderSource(fragShader, 1, &fragShaderSource, nullptr);
-      glCompileShader(fragShader);
-      CheckGlShaderError(fragShader);
+      Color const * const mapped = reinterpret_cast<Color const *>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, slot.bufferBytes, GL_MAP_READ_BIT));
 
-      GLuint geoShader = glCreateShader(GL_GEOMETRY_SHADER);
-      glShaderSource(geoShader, 1, &geoShaderSource, nullptr);
-      glCompileShader(geoShader);
-      CheckGlShaderError(geoShader);
+      if (mapped) {
+        capturePixels.resize(size_t(slot.size.x) * slot.size.y);
 
-      impl->shader = glCreateProgram();
-      glAttachShader(impl->shader, vertShader);
-      glAttachShader(impl->shader, geoShader);
-      glAttachShader(impl->shader, fragShader);
-      glLinkProgram(impl->shader);
+        // GL rows start at the bottom.
+        for (int y = 0; y < slot.size.y; ++y) {
+          Color const * const row = mapped + size_t(slot.size.y - 1 - y) * slot.size.x;
 
-      glUseProgram(impl->shader);
-      CheckGlShaderProgramError(impl->shader);
+          std::copy(row, row + slot.size.x, capturePixels.data() + size_t(y) * slot.size.x);
+        }
 
-      glGenBuffers(1, &impl->vertexBuffer);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
 
-      GLuint fontSheet;
-      glGenTextures(1, &fontSheet);
-      glBindTexture(GL_TEXTURE_RECTANGLE, fontSheet);
-      glTexImage2D(GL_TEXTURE_RECTANGLE, 0, GL_R8, 16 * GetGlyphSize().x, 16 * GetGlyphSize().y, 0, GL_RED, GL_UNSIGNED_BYTE, GetGlyphSheet());
+        AsciiCapturedFrame frame;
+        frame.size       = slot.size;
+        frame.frameIndex = slot.frameIndex;
+        frame.runNs      = slot.runNs;
+        frame.pixels     = capturePixels;
 
-      glBindFragDataLocation(impl->shader, 0, "outColor");
+        captureCallback(frame);
+      }
 
-      glBindBuffer(GL_ARRAY_BUFFER, impl->vertexBuffer);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 
-      impl->charAttr = glGetAttribLocation(impl->shader, "dispChar");
-      glEnableVertexAttribArray(impl->charAttr);
+      captureHead = (captureHead + 1) % c_captureSlotCount;
+      --capturePending;
+    }
+  }
 
-      impl->colorAttr = glGetAttribLocation(impl->shader, "colorIndices");
-      glEnableVertexAttribArray(impl->colorAttr);
+  // Must run on the thread that owns the context.
+  void FinishCapture(void) {
+    DeliverCaptures(true);
 
-      impl->gridSizeUniform      = glGetUniformLocation(impl->shader, "gridSize");
-      impl->glyphSizeUniform     = glGetUniformLocation(impl->shader, "glyphSize");
-      impl->fontSheetSizeUniform = glGetUniformLocation(impl->shader, "fontSheetSize");
-      impl->colorPaletteUniform  = glGetUniformLocation(impl->shader, "colorPalette");
-      impl->fontSheetUniform     = glGetUniformLocation(impl->shader, "fontSheet");
+    for (CaptureSlot & slot : captureSlots) {
+      if (slot.pixelBuffer != GL_INVALID_INDEX) {
+        glDeleteBuffers(1, &slot.pixelBuffer);
+      }
+
+      slot = CaptureSlot();
     }
+
+    captureHead        = 0;
+    capturedFrameIndex = 0;
   }
 
+  void StopCapture(void) {
+    if (!isCapturing) {
+      return;
+    }
+
+    isCapturing = false;
+
+    // The render thread owns the pixel buffers, so it has to flush them. Waking it without a new
+    // frame is enough for it to notice.
+    if (renderThread.joinable()) {
+      isCaptureStopRequested = true;
+
+      ++publishedFrames;
+      publishedFrames.notify_one();
+
+      isCaptureStopRequested.wait(true);
+    }
+    else {
+      FinishCapture();
+    }
+
+    captureCallback = nullptr;
+  }
+
+  void StartRenderThread(void) {
+    renderThread = std::thread(&Impl::RenderLoop, this);
+
+    // Callers expect the window to be usable once it's constructed.
+    isRenderThreadReady.wait(false);
+  }
+
+  void StopRenderThread(void) {
+    if (!renderThread.joinable()) {
+      return;
+    }
+
+    isStopping = true;
+    ++publishedFrames;
+    publishedFrames.notify_one();
+
+    renderThread.join();
+  }
+
+  void SubmitFrame(ivec2 const & frameSize, std::span<AsciiLayer const> layers, int64_t runNs) {
+    RenderFrame & frame = frames.GetWriteBuffer();
+
+    frame.size = frameSize;
+    frame.layers.resize(layers.size());
+    frame.offsets.resize(layers.size());
+    frame.paletteBanks.resize(layers.size());
+
+    for (size_t i = 0; i < layers.size(); ++i) {
+      frame.layers[i]       = *layers[i].cells;
+      frame.offsets[i]      = layers[i].offset;
+      frame.paletteBanks[i] = layers[i].paletteBank;
+    }
+
+    frame.isPacked   = false;
+    frame.font       = font;
+    frame.runNs      = runNs;
+    frame.streamMode = streamMode;
+
+    frames.Publish();
+
+    ++publishedFrames;
+    publishedFrames.notify_one();
+  }
+  void SubmitPackedFrame(Grid<AsciiPackedCell, 2> const & cells, int64_t runNs) {
+    RenderFrame & frame = frames.GetWriteBuffer();
+
+    frame.size        = cells.GetSize();
+    frame.packedCells = cells;
+    frame.isPacked    = true;
+    frame.font        = font;
+    frame.runNs       = runNs;
+    frame.streamMode  = streamMode;
+
+    frames.Publish();
+
+    ++publishedFrames;
+    publishedFrames.notify_one();
+  }
+
+
+  void RenderLoop(void) {
+    glfwMakeContextCurrent(window);
+    InitializeGl();
+
+    isRenderThreadReady = true;
+    isRenderThreadReady.notify_one();
+
+    unsigned int seenFrames = 0;
+
+    while (true) {
+      publishedFrames.wait(seenFrames);
+      seenFrames = publishedFrames;
+
+      if (isStopping) {
+        break;
+      }
+
+      if (frames.Consume()) {
+        RenderFrame const & frame = frames.GetReadBuffer();
+
+        if (frame.isPacked) {
+          RenderPacked(frame.packedCells, frame.font, frame.runNs, frame.streamMode);
+        }
+        else {
+          renderLayers.resize(frame.layers.size());
+          for (size_t i = 0; i < frame.layers.size(); ++i) {
+            renderLayers[i] = AsciiLayer(frame.layers[i], frame.offsets[i], frame.paletteBanks[i]);
+          }
+
+          Render(frame.size, renderLayers, frame.font, frame.runNs, frame.streamMode);
+        }
+      }
+
+      if (isCaptureStopRequested) {
+        FinishCapture();
+
+        isCaptureStopRequested = false;
+        isCaptureStopRequested.notify_one();
+      }
+    }
+
+    ReleaseRingBuffer();
+    glfwMakeContextCurrent(nullptr);
+  }
+
+  void Render(ivec2 const & frameSize, std::span<AsciiLayer const> layers, AsciiFont const & frameFont, int64_t frameRunNs, AsciiStreamMode frameStreamMode);
+  void RenderPacked(Grid<AsciiPackedCell, 2> const & cells, AsciiFont const & frameFont, int64_t frameRunNs, AsciiStreamMode frameStreamMode);
+
+  // Returns the glyph size of the atlas the frame is drawn with.
+  ivec2 BeginFrame(ivec2 const & frameSize, AsciiFont const & frameFont, int64_t frameRunNs, AsciiStreamMode frameStreamMode);
+  void EndFrame(ivec2 const & frameSize, ivec2 const & glyphSize, int64_t frameRunNs, int frameBytes);
+
+  // Returns the bytes uploaded. Ring offsets are in bytes and move past the layer's cells.
+  template <typename Cell>
+  int DrawLayer(int index, Grid<Cell, 2> const & cells, ivec2 const & offset, int paletteBank, ivec2 const & frameSize, ivec2 const & glyphSize, int & io_ringOffset);
+
+  template <typename Cell>
+  int UploadCells(LayerBuffer & io_layer, Grid<Cell, 2> const & draw);
+
+  template <typename Cell>
+  int UploadCellRows(Grid<Cell, 2> const & draw);
+
+  int BeginRingSegment(int bytes);
+
   ~Impl(void) {
+    StopCapture();
+    StopRenderThread();
+
     glfwDestroyWindow(window);
     glfwMakeContextCurrent(nullptr);
     glfwTerminate();
@@ -603,23 +1327,94 @@ struct AsciiWindow::Impl {
   static std::weak_ptr<Impl> s_impl;
 
   GLFWwindow * window                                                                         = nullptr;
-  int          startTime                                                                      = 0;
+  int64_t      startTime                                                                      = 0;
   bool         currentMouseButtons[int(AsciiButton::MouseEnd) - int(AsciiButton::MouseBegin)] = { 0 };
   bool         currentState[int(AsciiState::Count)]                                           = { 0 };
   int          cachedModState                                                                 = 0;
   ivec2        size                                                                           = ivec2(1, 1);
+  ivec2        windowGlyphSize                                                                = ivec2(0, 0);
   GLuint       vao                                                                            = GL_INVALID_INDEX;
-  GLuint       vertexBuffer                                                                   = GL_INVALID_INDEX;
   GLuint       shader                                                                         = GL_INVALID_INDEX;
   GLint        charAttr                                                                       = GL_INVALID_INDEX;
   GLint        colorAttr                                                                      = GL_INVALID_INDEX;
+  GLint        packedAttr                                                                     = GL_INVALID_INDEX;
   GLint        gridSizeUniform                                                                = GL_INVALID_INDEX;
   GLint        glyphSizeUniform                                                               = GL_INVALID_INDEX;
   GLint        fontSheetSizeUniform                                                           = GL_INVALID_INDEX;
   GLint        colorPaletteUniform                                                            = GL_INVALID_INDEX;
+  GLint        paletteCyclesUniform                                                           = GL_INVALID_INDEX;
+  GLint        paletteTimeUniform                                                             = GL_INVALID_INDEX;
+  GLint        paletteBankUniform                                                             = GL_INVALID_INDEX;
   GLint        fontSheetUniform                                                               = GL_INVALID_INDEX;
+  GLint        layerOffsetUniform                                                             = GL_INVALID_INDEX;
+  GLint        layerSizeUniform                                                               = GL_INVALID_INDEX;
+  GLint        isPackedCellsUniform                                                           = GL_INVALID_INDEX;
   AsciiFont    font;
   std::string  name;
+
+  Grid<AsciiCell, 2> backbuffer;
+
+  std::vector<LayerBuffer> layerBuffers;
+  std::vector<AsciiLayer>  renderLayers;
+  std::vector<CellSpan>    changedSpans;
+  std::atomic<int>         uploadedBytes = 0;
+  std::atomic<int>         uploadedCells = 0;
+  std::atomic<int64_t>     swapNs        = 0;
+
+  AsciiRenderMode renderMode                     = AsciiRenderMode::GeometryShader;
+  AsciiStreamMode streamMode                     = AsciiStreamMode::BufferUpdate;
+  GLuint          ringBuffer                     = GL_INVALID_INDEX;
+  unsigned char * ringData                       = nullptr;
+  int             ringSegmentBytes               = 0;
+  int             ringSegment                    = 0;
+  GLsync          ringFences[c_ringSegmentCount] = { nullptr };
+
+  GLuint    boundArrayBuffer    = 0;
+  GLuint    boundCellTexture    = 0;
+  GLuint    attributeBuffer     = GL_INVALID_INDEX;
+  GLintptr  attributeOffset     = -1;
+  ivec2     viewportOrigin      = ivec2(0, 0);
+  ivec2     viewportSize        = ivec2(0, 0);
+  ivec2     renderedLayerOffset = ivec2(0, 0);
+  ivec2     renderedLayerSize   = ivec2(0, 0);
+  int       renderedPaletteBank = 0;
+  int       renderedPaletteMs   = 0;
+  bool      isRenderingPacked   = false;
+  AsciiFont paletteFont;
+
+  AsciiThreadMode           threadMode          = AsciiThreadMode::CallerThread;
+  std::thread               renderThread;
+  TripleBuffer<RenderFrame> frames;
+  std::atomic<unsigned int> publishedFrames     = 0;
+  std::atomic<bool>         isRenderThreadReady = false;
+  std::atomic<bool>         isStopping          = false;
+
+  AsciiCaptureCallback captureCallback;
+  std::atomic<bool>    isCapturing            = false;
+  std::atomic<bool>    isCaptureStopRequested = false;
+  std::atomic<int>     droppedCaptureFrames   = 0;
+
+  // Only touched by the thread that owns the context.
+  ivec2                             renderedSize       = ivec2(0, 0);
+  AsciiStreamMode                   renderedStreamMode = AsciiStreamMode::BufferUpdate;
+  std::shared_ptr<GlyphAtlas const> renderedAtlas;
+  GlyphAtlasCache                   renderAtlasCache;
+
+  CaptureSlot        captureSlots[c_captureSlotCount];
+  int                captureHead        = 0;
+  int                capturePending     = 0;
+  int64_t            capturedFrameIndex = 0;
+  std::vector<Color> capturePixels;
+
+  std::atomic<int> glCallCount = 0;
+
+  AsciiInputEvent drainedInput[c_inputQueueCapacity];
+
+  bool              isMeasuringFrameTimes = false;
+  int64_t           lastDrawNs            = -1;
+  FrameTimeRecorder frameTimes;
+
+  FrameStatsRecorder frameStats;
 };
 
 std::weak_ptr<AsciiWindow::Impl> AsciiWindow::Impl::s_impl;
@@ -632,63 +1427,189 @@ char const * GetAsciiStateName(AsciiState state) {
   return s_asciiStateNames[int(state)];
 }
 
-AsciiWindow::AsciiWindow(void) {
+AsciiWindow::AsciiWindow(void) :
+  AsciiWindow(AsciiRenderMode::GeometryShader)
+{}
+
+AsciiWindow::AsciiWindow(AsciiRenderMode renderMode) :
+  AsciiWindow(renderMode, AsciiThreadMode::CallerThread)
+{}
+
+AsciiWindow::AsciiWindow(AsciiRenderMode renderMode, AsciiThreadMode threadMode) {
   m_impl = std::make_shared<Impl>();
+  m_impl->renderMode = renderMode;
+  m_impl->threadMode = threadMode;
 
   if (Impl::s_impl.expired()) {
     Impl::SetImpl(m_impl);
   }
 
-  m_impl->startTime = GetCurrentMs();
+  m_impl->startTime = GetCurrentNs();
 }
 
 void AsciiWindow::Draw(Grid<AsciiCell, 2> const & draw) {
-  {
-    ivec2 const size = draw.GetSize();
+  AsciiLayer const layer(draw);
 
-    if (m_impl->size != size) {
-      m_impl->size = size;
+  DrawLayers(draw.GetSize(), std::span<AsciiLayer const>(&layer, 1));
+}
 
-      glfwSetWindowSize(m_impl->window, size.x * GetGlyphSize().x, size.y * GetGlyphSize().y);
-      glViewport(0, 0, size.x * GetGlyphSize().x, size.y * GetGlyphSize().y);
-    }
+void AsciiWindow::DrawLayers(ivec2 const & size, std::span<AsciiLayer const> layers) {
+  int64_t const drawStartNs = GetRunNs();
+  int64_t const runNs       = BeginDraw(size);
 
-    glBufferData(GL_ARRAY_BUFFER, draw.Count() * sizeof(AsciiCell), draw.Data(), GL_STREAM_DRAW);
+  if (m_impl->renderThread.joinable()) {
+    m_impl->SubmitFrame(size, layers, runNs);
+  }
+  else {
+    m_impl->Render(size, layers, m_impl->font, runNs, m_impl->streamMode);
+  }
 
-    glVertexAttribIPointer(m_impl->charAttr, 1, GL_BYTE, sizeof(AsciiCell), &((AsciiCell *)0)->character);
-    glVertexAttribIPointer(m_impl->colorAttr, 2, GL_BYTE, sizeof(AsciiCell), &((AsciiCell *)0)->foregroundColor);
+  EndDraw(drawStartNs);
+}
 
-    glUniform2i(m_impl->gridSizeUniform, size.x, size.y);
-    glUniform2i(m_impl->glyphSizeUniform, GetGlyphSize().x, GetGlyphSize().y);
-    glUniform2i(m_impl->fontSheetSizeUniform, 16, 16);
+void AsciiWindow::DrawPacked(Grid<AsciiPackedCell, 2> const & draw) {
+  int64_t const drawStartNs = GetRunNs();
+  int64_t const runNs       = BeginDraw(draw.GetSize());
 
-    // Set colors
-    {
-      float colorPaletteValues[FontColorCount][3]; // rgb for 8 colors
+  if (m_impl->renderThread.joinable()) {
+    m_impl->SubmitPackedFrame(draw, runNs);
+  }
+  else {
+    m_impl->RenderPacked(draw, m_impl->font, runNs, m_impl->streamMode);
+  }
 
-      for (int i = 0; i < FontColorCount; ++i) {
-        colorPaletteValues[i][0] = float(m_impl->font.colors[i].r) / 255.0f;
-        colorPaletteValues[i][1] = float(m_impl->font.colors[i].g) / 255.0f;
-        colorPaletteValues[i][2] = float(m_impl->font.colors[i].b) / 255.0f;
-      }
+  EndDraw(drawStartNs);
+}
 
-      glUniform3fv(m_impl->colorPaletteUniform, 8, *colorPaletteValues);
+int64_t AsciiWindow::BeginDraw(ivec2 const & size) {
+  if (m_impl->isMeasuringFrameTimes) {
+    int64_t const nowNs = GetRunNs();
+
+    if (m_impl->lastDrawNs >= 0) {
+      m_impl->frameTimes.AddFrame(nowNs - m_impl->lastDrawNs);
     }
 
-    glDrawArrays(GL_POINTS, 0, draw.Count());
+    m_impl->lastDrawNs = nowNs;
+  }
+
+  // GLFW only allows this from the main thread, so it can't wait for the render thread. A new
+  // glyph atlas can change the glyph size too.
+  ivec2 const glyphSize = GetGlyphSize();
+
+  if (m_impl->size != size || m_impl->windowGlyphSize != glyphSize) {
+    m_impl->size            = size;
+    m_impl->windowGlyphSize = glyphSize;
+
+    glfwSetWindowSize(m_impl->window, size.x * glyphSize.x, size.y * glyphSize.y);
+  }
+
+  // Palette cycles and captures are timed from when the frame was drawn, not when the render
+  // thread gets to it.
+  return GetRunNs();
+}
+
+void AsciiWindow::EndDraw(int64_t drawStartNs) {
+  FrameStatsRecorder & stats  = m_impl->frameStats;
+  int64_t const        swapNs = m_impl->swapNs;
+  int64_t const        runNs  = GetRunNs();
+  int64_t              drawNs = runNs - drawStartNs;
+
+  // On the caller thread the swap happened inside the draw, and it's reported on its own.
+  if (!m_impl->renderThread.joinable()) {
+    drawNs -= swapNs;
+  }
+
+  stats.Add(&AsciiFrameStats::drawNs, drawNs);
+  stats.Add(&AsciiFrameStats::swapNs, swapNs);
+  stats.Add(&AsciiFrameStats::uploadedCells, m_impl->uploadedCells);
+  stats.EndFrame(runNs);
+}
 
-    glfwSwapBuffers(m_impl->window);
+Grid<AsciiCell, 2> & AsciiWindow::AcquireBackbuffer(void) {
+  if (m_impl->backbuffer.GetSize() != m_impl->size) {
+    m_impl->backbuffer = Grid<AsciiCell, 2>(m_impl->size);
   }
+
+  return m_impl->backbuffer;
+}
+
+int AsciiWindow::GetUploadedBytes(void) const {
+  return m_impl->uploadedBytes;
+}
+
+int AsciiWindow::GetGlCallCount(void) const {
+  return m_impl->glCallCount;
+}
+
+AsciiRenderMode AsciiWindow::GetRenderMode(void) const {
+  return m_impl->renderMode;
+}
+
+AsciiThreadMode AsciiWindow::GetThreadMode(void) const {
+  return m_impl->threadMode;
+}
+
+AsciiStreamMode AsciiWindow::GetStreamMode(void) const {
+  return m_impl->streamMode;
+}
+
+void AsciiWindow::StartCapture(AsciiCaptureCallback const & callback) {
+  m_impl->StopCapture();
+
+  m_impl->captureCallback      = callback;
+  m_impl->droppedCaptureFrames = 0;
+  m_impl->isCapturing          = true;
+}
+
+void AsciiWindow::StartCapture(std::shared_ptr<std::ostream> const & output) {
+  std::shared_ptr<PpmCaptureWriter> const writer = std::make_shared<PpmCaptureWriter>(output);
+
+  StartCapture([writer](AsciiCapturedFrame const & frame) {
+    writer->Write(frame);
+  });
+}
+
+void AsciiWindow::StopCapture(void) {
+  m_impl->StopCapture();
+}
+
+bool AsciiWindow::IsCapturing(void) const {
+  return m_impl->isCapturing;
+}
+
+int AsciiWindow::GetDroppedCaptureFrames(void) const {
+  return m_impl->droppedCaptureFrames;
+}
+
+void AsciiWindow::SetStreamMode(AsciiStreamMode mode) {
+  bool const canStreamToRing = IsPersistentMappingSupported() && m_impl->renderMode != AsciiRenderMode::CellTexture;
+
+  if (mode == AsciiStreamMode::PersistentRing && !canStreamToRing) {
+    mode = AsciiStreamMode::BufferUpdate;
+  }
+
+  // The renderer picks this up with the next frame, since it may be on another thread.
+  m_impl->streamMode = mode;
 }
 
 std::vector<AsciiInputEvent> AsciiWindow::PollInput(void) {
-  // This can be filled during sleep. We don't clear the input vector at the beginning to queue up those events too.
+  std::span<AsciiInputEvent const> const events = DrainInput();
+
+  return std::vector<AsciiInputEvent>(events.begin(), events.end());
+}
+
+std::span<AsciiInputEvent const> AsciiWindow::DrainInput(void) {
+  int64_t const pollStartNs = GetRunNs();
+
+  // The queue can be filled during sleep. It isn't cleared first so those events are kept too.
   glfwPollEvents();
 
-  std::vector<AsciiInputEvent> const forReturn = std::move(s_pollingInput);
-  s_pollingInput.clear();
+  int const count = s_inputQueue.PopInto(m_impl->drainedInput, c_inputQueueCapacity);
 
-  return forReturn;
+  m_impl->frameStats.Add(&AsciiFrameStats::pollNs, GetRunNs() - pollStartNs);
+  m_impl->frameStats.Add(&AsciiFrameStats::inputEvents, count);
+
+  return std::span<AsciiInputEvent const>(m_impl->drainedInput, count);
 }
 
 std::string AsciiWindow::GetClipboard(void) const {
@@ -722,20 +1643,371 @@ void AsciiWindow::SetFont(AsciiFont const & font) {
 }
 
 int AsciiWindow::GetRunMs(void) const {
-  return GetCurrentMs() - m_impl->startTime;
+  return int(GetRunNs() / c_nsPerMs);
 }
 
 void AsciiWindow::Sleep(int milliseconds) {
-  double currentTime      = glfwGetTime();
-  double const targetTime = currentTime + double(milliseconds) / 1000.0;
+  SleepUntilNs(GetRunNs() + milliseconds * c_nsPerMs);
+}
+
+int64_t AsciiWindow::GetRunUs(void) const {
+  return GetRunNs() / c_nsPerUs;
+}
+
+int64_t AsciiWindow::GetRunNs(void) const {
+  return GetCurrentNs() - m_impl->startTime;
+}
+
+void AsciiWindow::SleepUntilNs(int64_t runNs) {
+  int64_t const sleepStartNs = GetRunNs();
+
+  // OS waits can overshoot by a couple of milliseconds, so they stop short of the deadline and the
+  // rest is spent yielding.
+  while (true) {
+    int64_t const remainingNs = runNs - GetRunNs();
+
+    if (remainingNs <= 0) {
+      break;
+    }
+
+    if (remainingNs > c_sleepSpinNs) {
+      glfwWaitEventsTimeout(double(remainingNs - c_sleepSpinNs) / double(c_nsPerSecond));
+    }
+    else {
+      std::this_thread::yield();
+    }
+  }
+
+  m_impl->frameStats.Add(&AsciiFrameStats::sleepNs, GetRunNs() - sleepStartNs);
+}
+
+void AsciiWindow::SetFrameTimeMeasurement(bool isEnabled) {
+  if (isEnabled && !m_impl->isMeasuringFrameTimes) {
+    m_impl->frameTimes.Clear();
+  }
+
+  m_impl->isMeasuringFrameTimes = isEnabled;
+  m_impl->lastDrawNs            = -1;
+}
+
+FrameTimeRecorder const & AsciiWindow::GetFrameTimes(void) const {
+  return m_impl->frameTimes;
+}
+
+FrameStatsRecorder const & AsciiWindow::GetFrameStats(void) const {
+  return m_impl->frameStats;
+}
+
+void AsciiWindow::Impl::Render(ivec2 const & frameSize, std::span<AsciiLayer const> layers, AsciiFont const & frameFont, int64_t frameRunNs, AsciiStreamMode frameStreamMode) {
+  int const glCallsBefore = s_glCallCount;
+
+  ivec2 const glyphSize  = BeginFrame(frameSize, frameFont, frameRunNs, frameStreamMode);
+  int         ringOffset = 0;
+  int         frameBytes = 0;
+
+  if (renderedStreamMode == AsciiStreamMode::PersistentRing) {
+    int cellCount = 0;
+    for (AsciiLayer const & layer : layers) {
+      cellCount += layer.cells->Count();
+    }
+
+    ringOffset = BeginRingSegment(cellCount * int(sizeof(AsciiCell)));
+  }
+
+  for (int i = 0; i < int(layers.size()); ++i) {
+    frameBytes += DrawLayer(i, *layers[i].cells, layers[i].offset, layers[i].paletteBank, frameSize, glyphSize, ringOffset);
+  }
+
+  uploadedCells = frameBytes / int(sizeof(AsciiCell));
+
+  EndFrame(frameSize, glyphSize, frameRunNs, frameBytes);
+
+  glCallCount = s_glCallCount - glCallsBefore;
+}
+
+void AsciiWindow::Impl::RenderPacked(Grid<AsciiPackedCell, 2> const & cells, AsciiFont const & frameFont, int64_t frameRunNs, AsciiStreamMode frameStreamMode) {
+  int const glCallsBefore = s_glCallCount;
+
+  ivec2 const frameSize  = cells.GetSize();
+  ivec2 const glyphSize  = BeginFrame(frameSize, frameFont, frameRunNs, frameStreamMode);
+  int         ringOffset = 0;
+
+  if (renderedStreamMode == AsciiStreamMode::PersistentRing) {
+    ringOffset = BeginRingSegment(cells.Count() * int(sizeof(AsciiPackedCell)));
+  }
+
+  int const frameBytes = DrawLayer(0, cells, ivec2(0, 0), 0, frameSize, glyphSize, ringOffset);
+
+  uploadedCells = frameBytes / int(sizeof(AsciiPackedCell));
+
+  EndFrame(frameSize, glyphSize, frameRunNs, frameBytes);
+
+  glCallCount = s_glCallCount - glCallsBefore;
+}
+
+ivec2 AsciiWindow::Impl::BeginFrame(ivec2 const & frameSize, AsciiFont const & frameFont, int64_t frameRunNs, AsciiStreamMode frameStreamMode) {
+  std::shared_ptr<GlyphAtlas const> const & atlas          = renderAtlasCache.Get();
+  bool const                                isAtlasChanged = atlas != renderedAtlas;
+
+  if (isAtlasChanged) {
+    UploadGlyphAtlas(atlas);
+  }
+
+  ivec2 const glyphSize = atlas->GetGlyphSize();
+
+  if (renderedSize != frameSize || isAtlasChanged) {
+    renderedSize = frameSize;
+
+    SetViewport(ivec2(0, 0), frameSize * glyphSize);
+    glUniform2i(gridSizeUniform, frameSize.x, frameSize.y);
+  }
+
+  if (frameStreamMode != renderedStreamMode) {
+    if (frameStreamMode == AsciiStreamMode::BufferUpdate) {
+      ReleaseRingBuffer();
+    }
+
+    renderedStreamMode = frameStreamMode;
+  }
+
+  int const frameRunMs = int(frameRunNs / c_nsPerMs);
+
+  // Set colors
+  bool const isFontChanged = !(frameFont == paletteFont);
+  bool const isAnimated    = IsPaletteAnimated(frameFont);
+
+  if (isFontChanged) {
+    float colorPaletteValues[PaletteColorCount][3];
+    int   cycleValues[PaletteCycleCount][4] = {};
+
+    for (int i = 0; i < PaletteColorCount; ++i) {
+      colorPaletteValues[i][0] = float(frameFont.colors[i].r) / 255.0f;
+      colorPaletteValues[i][1] = float(frameFont.colors[i].g) / 255.0f;
+      colorPaletteValues[i][2] = float(frameFont.colors[i].b) / 255.0f;
+    }
+
+    // Cycles that do nothing are sent as empty so the shader never has to range check them.
+    for (int i = 0; i < PaletteCycleCount; ++i) {
+      PaletteCycle const & cycle = frameFont.cycles[i];
+
+      if (IsPaletteCycleActive(cycle)) {
+        cycleValues[i][0] = cycle.first;
+        cycleValues[i][1] = cycle.count;
+        cycleValues[i][2] = cycle.stepMs;
+        cycleValues[i][3] = cycle.isSmooth ? 1 : 0;
+      }
+    }
+
+    glUniform3fv(colorPaletteUniform, PaletteColorCount, *colorPaletteValues);
+    glUniform4iv(paletteCyclesUniform, PaletteCycleCount, *cycleValues);
+
+    paletteFont = frameFont;
+  }
+
+  // Only the time changes while a palette animates, so that's all a frame sends.
+  if (isAnimated && frameRunMs != renderedPaletteMs) {
+    glUniform1i(paletteTimeUniform, frameRunMs);
+
+    renderedPaletteMs = frameRunMs;
+  }
+
+  if (isFontChanged || isAnimated) {
+    Color palette[PaletteColorCount];
+    EvaluatePalette(frameFont, renderedPaletteMs, palette);
+
+    // Anything no layer covers, or that only transparent cells cover, shows color 0.
+    glClearColor(float(palette[0].r) / 255.0f, float(palette[0].g) / 255.0f, float(palette[0].b) / 255.0f, 1.0f);
+  }
+
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  return glyphSize;
+}
+
+void AsciiWindow::Impl::EndFrame(ivec2 const & frameSize, ivec2 const & glyphSize, int64_t frameRunNs, int frameBytes) {
+  uploadedBytes = frameBytes;
+
+  if (renderedStreamMode == AsciiStreamMode::PersistentRing) {
+    ringFences[ringSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+
+  if (isCapturing) {
+    CaptureFrame(frameSize * glyphSize, frameRunNs);
+  }
+
+  int64_t const swapStartNs = AsciiWindow::GetCurrentNs();
+
+  glfwSwapBuffers(window);
+
+  swapNs = AsciiWindow::GetCurrentNs() - swapStartNs;
+}
 
-  do {
-    glfwWaitEventsTimeout(targetTime - currentTime);
+template <typename Cell>
+int AsciiWindow::Impl::DrawLayer(int index, Grid<Cell, 2> const & cells, ivec2 const & offset, int paletteBank, ivec2 const & frameSize, ivec2 const & glyphSize, int & io_ringOffset) {
+  if (cells.Count() == 0) {
+    return 0;
+  }
+
+  SetCellFormat(std::is_same_v<Cell, AsciiPackedCell>);
+  SetLayerUniforms(offset, cells.GetSize(), paletteBank);
+
+  int bytes = 0;
+
+  if (renderedStreamMode == AsciiStreamMode::PersistentRing) {
+    std::copy(cells.begin(), cells.end(), reinterpret_cast<Cell *>(ringData + io_ringOffset));
+
+    BindArrayBuffer(ringBuffer);
+    SetCellAttributes<Cell>(io_ringOffset);
+
+    bytes          = cells.Count() * int(sizeof(Cell));
+    io_ringOffset += bytes;
+  }
+  else if (renderMode == AsciiRenderMode::CellTexture) {
+    LayerBuffer & buffer = GetLayerBuffer(index);
+
+    BindCellTexture(buffer.cellTexture);
+    bytes = UploadCells(buffer, cells);
+  }
+  else {
+    LayerBuffer & buffer = GetLayerBuffer(index);
+
+    BindArrayBuffer(buffer.vertexBuffer);
+    bytes = UploadCells(buffer, cells);
+    SetCellAttributes<Cell>(0);
+  }
+
+  if (renderMode == AsciiRenderMode::CellTexture) {
+    // GL puts the origin at the bottom left, so the layer's rows are counted from the bottom.
+    ivec2 const origin = ivec2(offset.x, frameSize.y - offset.y - cells.GetSize().y);
+
+    SetViewport(origin * glyphSize, cells.GetSize() * glyphSize);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+  else if (renderMode == AsciiRenderMode::InstancedQuads) {
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, cells.Count());
+  }
+  else {
+    glDrawArrays(GL_POINTS, 0, cells.Count());
+  }
 
-    currentTime = glfwGetTime();
-  } while (currentTime < targetTime);
+  return bytes;
 }
 
-int AsciiWindow::GetCurrentMs(void) const {
-  return int(glfwGetTime() * 1000);
+template <typename Cell>
+int AsciiWindow::Impl::UploadCells(LayerBuffer & io_layer, Grid<Cell, 2> const & draw) {
+  constexpr bool isPacked      = std::is_same_v<Cell, AsciiPackedCell>;
+  bool const     isCellTexture = renderMode == AsciiRenderMode::CellTexture;
+
+  Grid<Cell, 2> * submittedGrid = nullptr;
+
+  // The other format's grid is emptied so switching back can't be mistaken for an unchanged layer.
+  if constexpr (isPacked) {
+    submittedGrid = &io_layer.submittedPackedGrid;
+
+    if (io_layer.submittedGrid.Count() > 0) {
+      io_layer.submittedGrid = Grid<AsciiCell, 2>();
+    }
+  }
+  else {
+    submittedGrid = &io_layer.submittedGrid;
+
+    if (io_layer.submittedPackedGrid.Count() > 0) {
+      io_layer.submittedPackedGrid = Grid<AsciiPackedCell, 2>();
+    }
+  }
+
+  Grid<Cell, 2> & submitted = *submittedGrid;
+
+  if (submitted.GetSize() != draw.GetSize()) {
+    if (isCellTexture) {
+      if constexpr (isPacked) {
+        glTexImage2D(GL_TEXTURE_RECTANGLE, 0, GL_R32UI, draw.GetSize().x, draw.GetSize().y, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, draw.Data());
+      }
+      else {
+        glTexImage2D(GL_TEXTURE_RECTANGLE, 0, GL_RGB8UI, draw.GetSize().x, draw.GetSize().y, 0, GL_RGB_INTEGER, GL_UNSIGNED_BYTE, draw.Data());
+      }
+    }
+    else {
+      glBufferData(GL_ARRAY_BUFFER, draw.Count() * sizeof(Cell), draw.Data(), GL_DYNAMIC_DRAW);
+    }
+
+    submitted = draw;
+    return draw.Count() * sizeof(Cell);
+  }
+
+  std::vector<CellSpan> & spans = changedSpans;
+  FindChangedCellSpans(submitted.Data(), draw.Data(), draw.Count(), c_uploadSpanMergeDistance, spans);
+
+  if (int(spans.size()) > c_maxUploadSpans) {
+    CellSpan const combined(spans.front().begin, spans.back().end);
+
+    spans.clear();
+    spans.emplace_back(combined);
+  }
+
+  int bytes = 0;
+
+  if (isCellTexture) {
+    bytes = UploadCellRows(draw);
+  }
+  else {
+    for (CellSpan const & span : spans) {
+      glBufferSubData(GL_ARRAY_BUFFER, span.begin * sizeof(Cell), span.Count() * sizeof(Cell), draw.Data() + span.begin);
+    }
+
+    bytes = CountSpanCells(spans) * sizeof(Cell);
+  }
+
+  for (CellSpan const & span : spans) {
+    std::copy(draw.Data() + span.begin, draw.Data() + span.end, submitted.Data() + span.begin);
+  }
+
+  return bytes;
+}
+
+template <typename Cell>
+int AsciiWindow::Impl::UploadCellRows(Grid<Cell, 2> const & draw) {
+  constexpr bool isPacked = std::is_same_v<Cell, AsciiPackedCell>;
+  GLenum const   format   = isPacked ? GL_RED_INTEGER : GL_RGB_INTEGER;
+  GLenum const   type     = isPacked ? GL_UNSIGNED_INT : GL_UNSIGNED_BYTE;
+
+  int const width   = draw.GetSize().x;
+  int       rowsEnd = 0;
+  int       bytes   = 0;
+
+  // Spans can wrap across rows, so each one is widened to the whole rows it touches.
+  for (CellSpan const & span : changedSpans) {
+    int const rowBegin = std::max(span.begin / width, rowsEnd);
+    int const rowEnd   = (span.end - 1) / width + 1;
+
+    if (rowBegin >= rowEnd) {
+      continue;
+    }
+
+    glTexSubImage2D(GL_TEXTURE_RECTANGLE, 0, 0, rowBegin, width, rowEnd - rowBegin, format, type, draw.Data() + rowBegin * width);
+
+    rowsEnd  = rowEnd;
+    bytes   += (rowEnd - rowBegin) * width * sizeof(Cell);
+  }
+
+  return bytes;
+}
+
+int AsciiWindow::Impl::BeginRingSegment(int bytes) {
+  ReserveRingBuffer(bytes);
+
+  ringSegment = (ringSegment + 1) % c_ringSegmentCount;
+
+  // The segment was last drawn from c_ringSegmentCount frames ago, so this rarely has to wait.
+  WaitForFence(ringFences[ringSegment]);
+
+  return ringSegment * ringSegmentBytes;
+}
+
+int64_t AsciiWindow::GetCurrentNs(void) {
+  uint64_t const ticks     = glfwGetTimerValue();
+  uint64_t const frequency = glfwGetTimerFrequency();
+
+  // Split up so the multiply can't overflow on long runs with fast timers.
+  return int64_t((ticks / frequency) * c_nsPerSecond + (ticks % frequency) * c_nsPerSecond / frequency);
 }
@@ -59,8 +59,8 @@ TEST_F(InputManagerTest, ButtonEventRegistered_ButtonEventProcessed_EventTrigger
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   std::shared_ptr<IMouseManager> mouseManager;
@@ -89,8 +89,8 @@ TEST_F(InputManagerTest, MousePositionEventRegistered_MousePositionEventProcesse
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   auto mouseManager = std::make_shared<MockMouseManager>();
@@ -119,8 +119,8 @@ TEST_F(InputManagerTest, MouseScrollEventRegistered_MouseScrollEventProcessed_Ev
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   auto mouseManager = std::make_shared<MockMouseManager>();
@@ -149,8 +149,8 @@ TEST_F(InputManagerTest, StateEventRegistered_MouseScrollEventProcessed_EventTri
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   auto stateManager = std::make_shared<MockStateManager>();
@@ -208,8 +208,8 @@ TEST_F(InputManagerTest, NullMouseManager_MousePositionEventProcessed_DoesNothin
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   InputManager inputManager(asciiWindow, nullptr, nullptr, nullptr, nullptr);
@@ -223,8 +223,8 @@ TEST_F(InputManagerTest, NullMouseManager_MouseScrollEventProcessed_DoesNothing)
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   InputManager inputManager(asciiWindow, nullptr, nullptr, nullptr, nullptr);
@@ -238,8 +238,8 @@ TEST_F(InputManagerTest, NullButtonManager_ButtonEventProcessed_DoesNothing) {
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   InputManager inputManager(asciiWindow, nullptr, nullptr, nullptr, nullptr);
@@ -253,8 +253,8 @@ TEST_F(InputManagerTest, NullButtonManager_StateEventProcessed_DoesNothing) {
   };
 
   auto asciiWindow = std::make_shared<MockAsciiWindow>();
-  EXPECT_CALL(*asciiWindow, PollInput())
-    .WillOnce(Return(events))
+  EXPECT_CALL(*asciiWindow, DrainInput())
+    .WillOnce(Return(std::span<AsciiInputEvent const>(events)))
   ;
 
   InputManager inputManager(asciiWindow, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,190 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/AnsiEncoder.h"
+#include "gtest/gtest.h"
+
+namespace {
+  AnsiFrameEncoder MakeEncoder(void) {
+    Color palette[PaletteColorCount];
+    for (int i = 0; i < PaletteColorCount; ++i) {
+      palette[i] = Color((unsigned char)(i), (unsigned char)(i), (unsigned char)(i));
+    }
+
+    AnsiFrameEncoder encoder;
+    encoder.SetPalette(palette);
+
+    return encoder;
+  }
+
+  // Encodes grid as the first frame so later frames only write their differences.
+  AnsiFrameEncoder MakeEncoderShowing(Grid<AsciiCell, 2> const & grid) {
+    AnsiFrameEncoder encoder = MakeEncoder();
+    std::string      output;
+
+    encoder.Encode(grid, output);
+
+    return encoder;
+  }
+}
+
+TEST(AnsiEncoderTest, FirstFrame_Encode_ClearsAndWritesEveryCell) {
+  AnsiFrameEncoder         encoder = MakeEncoder();
+  Grid<AsciiCell, 2> const grid(ivec2(3, 2), AsciiCell('x', 1, 2));
+  std::string              output;
+
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[0m\x1b[2J\x1b[H\x1b[38;2;1;1;1;48;2;2;2;2mxxx\x1b[2Hxxx");
+}
+
+TEST(AnsiEncoderTest, TransparentBackground_Encode_UsesColorZero) {
+  AnsiFrameEncoder         encoder = MakeEncoder();
+  Grid<AsciiCell, 2> const grid(ivec2(1, 1), AsciiCell('x', 3, TransparentColor));
+  std::string              output;
+
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[0m\x1b[2J\x1b[H\x1b[38;2;3;3;3;48;2;0;0;0mx");
+}
+
+TEST(AnsiEncoderTest, UnchangedFrame_Encode_WritesNothing) {
+  Grid<AsciiCell, 2> const grid(ivec2(80, 24), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder         encoder = MakeEncoderShowing(grid);
+  std::string              output;
+
+  encoder.Encode(grid, output);
+
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(AnsiEncoderTest, OneCellChanged_Encode_MovesCursorAndWritesCell) {
+  Grid<AsciiCell, 2> grid(ivec2(80, 24), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  grid[ivec2(2, 1)] = AsciiCell('x', 1, 2);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[2;3Hx");
+}
+
+TEST(AnsiEncoderTest, SmallGapWithSameColors_Encode_RewritesGapInsteadOfMoving) {
+  Grid<AsciiCell, 2> grid(ivec2(80, 24), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  grid[ivec2(2, 0)] = AsciiCell('x', 1, 2);
+  grid[ivec2(4, 0)] = AsciiCell('y', 1, 2);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[1;3Hx.y");
+}
+
+TEST(AnsiEncoderTest, SmallGapRewritten_GetWrittenCells_CountsGap) {
+  Grid<AsciiCell, 2> grid(ivec2(80, 24), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  EXPECT_EQ(encoder.GetWrittenCells(), 80 * 24);
+
+  grid[ivec2(2, 0)] = AsciiCell('x', 1, 2);
+  grid[ivec2(4, 0)] = AsciiCell('y', 1, 2);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(encoder.GetWrittenCells(), 3);
+}
+
+TEST(AnsiEncoderTest, LargeGap_Encode_MovesCursorForward) {
+  Grid<AsciiCell, 2> grid(ivec2(80, 24), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  grid[ivec2(0, 0)]  = AsciiCell('x', 1, 2);
+  grid[ivec2(20, 0)] = AsciiCell('y', 1, 2);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[Hx\x1b[19Cy");
+}
+
+TEST(AnsiEncoderTest, ChangeAtStartOfNextRow_Encode_UsesNewline) {
+  Grid<AsciiCell, 2> grid(ivec2(4, 4), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  grid[ivec2(1, 0)] = AsciiCell('a', 1, 2);
+  grid[ivec2(0, 1)] = AsciiCell('b', 1, 2);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[1;2Ha\r\nb");
+}
+
+TEST(AnsiEncoderTest, OnlyForegroundChanged_Encode_SetsOnlyForeground) {
+  Grid<AsciiCell, 2> grid(ivec2(8, 8), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  grid[ivec2(0, 0)] = AsciiCell('.', 5, 2);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[H\x1b[38;2;5;5;5m.");
+}
+
+TEST(AnsiEncoderTest, BlankCellWithNewForeground_Encode_SetsOnlyBackground) {
+  Grid<AsciiCell, 2> grid(ivec2(8, 8), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder   encoder = MakeEncoderShowing(grid);
+  std::string        output;
+
+  grid[ivec2(0, 0)] = AsciiCell(' ', 6, 3);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[H\x1b[48;2;3;3;3m ");
+}
+
+TEST(AnsiEncoderTest, SizeChanged_Encode_RedrawsEverything) {
+  Grid<AsciiCell, 2> const grid(ivec2(8, 8), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder         encoder = MakeEncoderShowing(grid);
+  std::string              output;
+
+  encoder.Encode(Grid<AsciiCell, 2>(ivec2(2, 1), AsciiCell('.', 1, 2)), output);
+
+  EXPECT_EQ(output, "\x1b[0m\x1b[2J\x1b[H\x1b[38;2;1;1;1;48;2;2;2;2m..");
+}
+
+TEST(AnsiEncoderTest, Invalidated_Encode_RedrawsEverything) {
+  Grid<AsciiCell, 2> const grid(ivec2(2, 1), AsciiCell('.', 1, 2));
+  AnsiFrameEncoder         encoder = MakeEncoderShowing(grid);
+  std::string              output;
+
+  encoder.Invalidate();
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[0m\x1b[2J\x1b[H\x1b[38;2;1;1;1;48;2;2;2;2m..");
+}
+
+TEST(AnsiEncoderTest, BlockFontGlyphs_GetAnsiGlyphText_ReturnsUtf8) {
+  EXPECT_STREQ(GetAnsiGlyphText('A'), "A");
+  EXPECT_STREQ(GetAnsiGlyphText(1), "\xE2\x98\xBA");
+  EXPECT_STREQ(GetAnsiGlyphText(219), "\xE2\x96\x88");
+  EXPECT_STREQ(GetAnsiGlyphText(0), " ");
+}
+
+TEST(AnsiEncoderTest, OnePaletteColorChanged_Encode_RewritesOnlyCellsUsingIt) {
+  Grid<AsciiCell, 2> grid(ivec2(80, 24), AsciiCell('.', 1, 2));
+  grid[ivec2(3, 1)] = AsciiCell('x', 4, 2);
+
+  AnsiFrameEncoder encoder = MakeEncoderShowing(grid);
+  std::string      output;
+
+  Color palette[PaletteColorCount];
+  for (int i = 0; i < PaletteColorCount; ++i) {
+    palette[i] = Color((unsigned char)(i), (unsigned char)(i), (unsigned char)(i));
+  }
+  palette[4] = Color(9, 9, 9);
+
+  encoder.SetPalette(palette);
+  encoder.Encode(grid, output);
+
+  EXPECT_EQ(output, "\x1b[2;4H\x1b[38;2;9;9;9mx");
+}
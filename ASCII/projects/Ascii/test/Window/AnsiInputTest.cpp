@@ -0,0 +1,161 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <cstring>
+
+#include "Window/AnsiInput.h"
+#include "gtest/gtest.h"
+
+namespace {
+  std::vector<AsciiInputEvent> Parse(AnsiInputParser & parser, char const * bytes) {
+    std::vector<AsciiInputEvent> events;
+    parser.Parse(bytes, int(std::strlen(bytes)), events);
+    return events;
+  }
+
+  void ExpectButton(AsciiInputEvent const & event, AsciiButton button, bool isDown) {
+    ASSERT_EQ(event.type, AsciiInputType::Button);
+    EXPECT_EQ(event.buttonEvent.button, button);
+    EXPECT_EQ(event.buttonEvent.isDown, isDown);
+  }
+
+  void ExpectState(AsciiInputEvent const & event, AsciiState state, bool isActive) {
+    ASSERT_EQ(event.type, AsciiInputType::State);
+    EXPECT_EQ(event.stateEvent.state, state);
+    EXPECT_EQ(event.stateEvent.isActive, isActive);
+  }
+}
+
+TEST(AnsiInputTest, LowercaseLetter_Parse_PressAndRelease) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "q");
+
+  ASSERT_EQ(events.size(), 2);
+  ExpectButton(events[0], AsciiButton::Q, true);
+  ExpectButton(events[1], AsciiButton::Q, false);
+}
+
+TEST(AnsiInputTest, ShiftedSymbol_Parse_PressWrappedInShift) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "?");
+
+  ASSERT_EQ(events.size(), 4);
+  ExpectState(events[0], AsciiState::Shift, true);
+  ExpectButton(events[1], AsciiButton::ForwardSlash, true);
+  ExpectButton(events[2], AsciiButton::ForwardSlash, false);
+  ExpectState(events[3], AsciiState::Shift, false);
+}
+
+TEST(AnsiInputTest, ControlByte_Parse_PressWrappedInControl) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x03");
+
+  ASSERT_EQ(events.size(), 4);
+  ExpectState(events[0], AsciiState::Control, true);
+  ExpectButton(events[1], AsciiButton::C, true);
+  ExpectState(events[3], AsciiState::Control, false);
+}
+
+TEST(AnsiInputTest, ArrowSequences_Parse_ArrowKeys) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[A\x1bOD");
+
+  ASSERT_EQ(events.size(), 4);
+  ExpectButton(events[0], AsciiButton::Up, true);
+  ExpectButton(events[2], AsciiButton::Left, true);
+}
+
+TEST(AnsiInputTest, ModifiedArrow_Parse_PressWrappedInModifiers) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[1;6C");
+
+  ASSERT_EQ(events.size(), 6);
+  ExpectState(events[0], AsciiState::Shift, true);
+  ExpectState(events[1], AsciiState::Control, true);
+  ExpectButton(events[2], AsciiButton::Right, true);
+  ExpectButton(events[3], AsciiButton::Right, false);
+  ExpectState(events[4], AsciiState::Control, false);
+  ExpectState(events[5], AsciiState::Shift, false);
+}
+
+TEST(AnsiInputTest, TildeSequences_Parse_EditingAndFunctionKeys) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[3~\x1b[24~\x1bOP");
+
+  ASSERT_EQ(events.size(), 6);
+  ExpectButton(events[0], AsciiButton::Delete, true);
+  ExpectButton(events[2], AsciiButton::F12, true);
+  ExpectButton(events[4], AsciiButton::F1, true);
+}
+
+TEST(AnsiInputTest, SequenceSplitAcrossReads_Parse_KeyReportedOnce) {
+  AnsiInputParser parser;
+
+  EXPECT_TRUE(Parse(parser, "\x1b[1").empty());
+
+  std::vector<AsciiInputEvent> const events = Parse(parser, "5~");
+
+  ASSERT_EQ(events.size(), 2);
+  ExpectButton(events[0], AsciiButton::F5, true);
+}
+
+TEST(AnsiInputTest, LoneEscape_Flush_EscapeKey) {
+  AnsiInputParser parser;
+
+  EXPECT_TRUE(Parse(parser, "\x1b").empty());
+
+  std::vector<AsciiInputEvent> events;
+  parser.Flush(events);
+
+  ASSERT_EQ(events.size(), 2);
+  ExpectButton(events[0], AsciiButton::Escape, true);
+}
+
+TEST(AnsiInputTest, EscapeThenCharacter_Parse_PressWrappedInAlt) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1bx");
+
+  ASSERT_EQ(events.size(), 4);
+  ExpectState(events[0], AsciiState::Alt, true);
+  ExpectButton(events[1], AsciiButton::X, true);
+}
+
+TEST(AnsiInputTest, MousePressAndRelease_Parse_PositionAndButtonEvents) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[<0;10;5M\x1b[<0;10;5m");
+
+  ASSERT_EQ(events.size(), 3);
+  ASSERT_EQ(events[0].type, AsciiInputType::MousePosition);
+  EXPECT_EQ(events[0].mousePositionEvent, ivec2(9, 4));
+  ExpectButton(events[1], AsciiButton::Mouse1, true);
+  ExpectButton(events[2], AsciiButton::Mouse1, false);
+}
+
+TEST(AnsiInputTest, MouseMotionAndWheel_Parse_PositionAndScrollEvents) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[<35;3;4M\x1b[<65;3;4M");
+
+  ASSERT_EQ(events.size(), 2);
+  ASSERT_EQ(events[0].type, AsciiInputType::MousePosition);
+  EXPECT_EQ(events[0].mousePositionEvent, ivec2(2, 3));
+  ASSERT_EQ(events[1].type, AsciiInputType::MouseScroll);
+  EXPECT_EQ(events[1].mouseScrollEvent, -1);
+}
+
+TEST(AnsiInputTest, LongMouseParameter_Parse_PositionClamped) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[<35;99999999999999999999;4M");
+
+  ASSERT_EQ(events.size(), 1);
+  ASSERT_EQ(events[0].type, AsciiInputType::MousePosition);
+  EXPECT_EQ(events[0].mousePositionEvent, ivec2(9998, 3));
+}
+
+TEST(AnsiInputTest, UnknownSequence_Parse_Ignored) {
+  AnsiInputParser                    parser;
+  std::vector<AsciiInputEvent> const events = Parse(parser, "\x1b[99za");
+
+  ASSERT_EQ(events.size(), 2);
+  ExpectButton(events[0], AsciiButton::A, true);
+}
@@ -0,0 +1,41 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/CaptureWriter.h"
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+TEST(CaptureWriterTest, FrameWritten_Write_PpmHeaderThenPixels) {
+  std::shared_ptr<std::ostringstream> const output = std::make_shared<std::ostringstream>();
+  PpmCaptureWriter                          writer(output);
+  Color const                               pixels[] = { Color(1, 2, 3), Color(4, 5, 6) };
+
+  AsciiCapturedFrame frame;
+  frame.size   = ivec2(2, 1);
+  frame.pixels = pixels;
+  writer.Write(frame);
+
+  EXPECT_EQ(output->str(), std::string("P6\n2 1\n255\n\x01\x02\x03\x04\x05\x06", 17));
+  EXPECT_EQ(writer.GetWrittenFrames(), 1);
+}
+
+TEST(CaptureWriterTest, FramesOfDifferentSizes_Write_EachImageHasItsOwnHeader) {
+  std::shared_ptr<std::ostringstream> const output = std::make_shared<std::ostringstream>();
+  PpmCaptureWriter                          writer(output);
+  Color const                               pixels[4];
+
+  AsciiCapturedFrame frame;
+  frame.size   = ivec2(1, 1);
+  frame.pixels = std::span<Color const>(pixels, 1);
+  writer.Write(frame);
+
+  frame.size   = ivec2(2, 2);
+  frame.pixels = pixels;
+  writer.Write(frame);
+
+  EXPECT_EQ(output->str(), std::string("P6\n1 1\n255\n", 11) + std::string(3, '\0') + "P6\n2 2\n255\n" + std::string(12, '\0'));
+  EXPECT_EQ(writer.GetWrittenFrames(), 2);
+}
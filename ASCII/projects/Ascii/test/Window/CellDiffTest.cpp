@@ -0,0 +1,97 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/CellDiff.h"
+#include "gtest/gtest.h"
+
+TEST(CellDiffTest, IdenticalCells_FindChangedSpans_NoSpans) {
+  std::vector<AsciiCell> const previous(100, AsciiCell('a', 1, 2));
+  std::vector<AsciiCell> const current(100, AsciiCell('a', 1, 2));
+
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous.data(), current.data(), 100, 0, spans);
+
+  EXPECT_TRUE(spans.empty());
+  EXPECT_EQ(CountSpanCells(spans), 0);
+}
+
+TEST(CellDiffTest, SingleCellChanged_FindChangedSpans_SpanCoversOnlyThatCell) {
+  std::vector<AsciiCell> const previous(100);
+  std::vector<AsciiCell>       current(100);
+  current[57].foregroundColor = 3;
+
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous.data(), current.data(), 100, 0, spans);
+
+  ASSERT_EQ(spans.size(), 1);
+  EXPECT_EQ(spans[0], CellSpan(57, 58));
+}
+
+TEST(CellDiffTest, DistantCellsChanged_FindChangedSpans_SeparateSpans) {
+  std::vector<AsciiCell> const previous(100);
+  std::vector<AsciiCell>       current(100);
+  current[0].character  = 'x';
+  current[1].character  = 'x';
+  current[99].character = 'x';
+
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous.data(), current.data(), 100, 4, spans);
+
+  ASSERT_EQ(spans.size(), 2);
+  EXPECT_EQ(spans[0], CellSpan(0, 2));
+  EXPECT_EQ(spans[1], CellSpan(99, 100));
+  EXPECT_EQ(CountSpanCells(spans), 3);
+}
+
+TEST(CellDiffTest, NearbyCellsChanged_FindChangedSpans_SpansMerged) {
+  std::vector<AsciiCell> const previous(100);
+  std::vector<AsciiCell>       current(100);
+  current[30].backgroundColor = 1;
+  current[34].backgroundColor = 1;
+
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous.data(), current.data(), 100, 4, spans);
+
+  ASSERT_EQ(spans.size(), 1);
+  EXPECT_EQ(spans[0], CellSpan(30, 35));
+}
+
+TEST(CellDiffTest, StaleSpansInOutput_FindChangedSpans_OutputCleared) {
+  std::vector<AsciiCell> const cells(10);
+
+  std::vector<CellSpan> spans = { CellSpan(1, 2) };
+  FindChangedCellSpans(cells.data(), cells.data(), 10, 0, spans);
+
+  EXPECT_TRUE(spans.empty());
+}
+
+TEST(CellDiffTest, PackedCellsChangedAcrossBlocksAndTail_FindChangedSpans_SpansMatchChangedCells) {
+  std::vector<AsciiPackedCell> const previous(70, AsciiPackedCell(300, 1, 2));
+  std::vector<AsciiPackedCell>       current(70, AsciiPackedCell(300, 1, 2));
+  current[3]  = AsciiPackedCell(301, 1, 2);
+  current[17] = AsciiPackedCell(300, 1, 3);
+  current[18] = AsciiPackedCell(300, 1, 3);
+  current[69] = AsciiPackedCell(300, 2, 2);
+
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous.data(), current.data(), 70, 0, spans);
+
+  ASSERT_EQ(spans.size(), 3);
+  EXPECT_EQ(spans[0], CellSpan(3, 4));
+  EXPECT_EQ(spans[1], CellSpan(17, 19));
+  EXPECT_EQ(spans[2], CellSpan(69, 70));
+}
+
+TEST(CellDiffTest, NearbyPackedCellsChanged_FindChangedSpans_SpansMerged) {
+  std::vector<AsciiPackedCell> const previous(100);
+  std::vector<AsciiPackedCell>       current(100);
+  current[30] = AsciiPackedCell(' ', 0, 1);
+  current[34] = AsciiPackedCell(' ', 0, 1);
+
+  std::vector<CellSpan> spans;
+  FindChangedCellSpans(previous.data(), current.data(), 100, 4, spans);
+
+  ASSERT_EQ(spans.size(), 1);
+  EXPECT_EQ(spans[0], CellSpan(30, 35));
+}
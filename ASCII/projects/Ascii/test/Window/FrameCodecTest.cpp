@@ -0,0 +1,176 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/FrameCodec.h"
+#include "gtest/gtest.h"
+
+namespace {
+  std::vector<AsciiCell> MakeCells(int count) {
+    std::vector<AsciiCell> cells(count);
+
+    for (int i = 0; i < count; ++i) {
+      cells[i] = AsciiCell(char('a' + i % 26), i % 8, (i / 8) % 8);
+    }
+
+    return cells;
+  }
+}
+
+TEST(FrameCodecTest, VarUints_WriteThenRead_ValuesMatch) {
+  std::vector<unsigned char> bytes;
+  uint64_t const             values[] = { 0, 1, 127, 128, 300, 0xFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull };
+
+  for (uint64_t value : values) {
+    WriteVarUint(value, bytes);
+  }
+
+  unsigned char const * read = bytes.data();
+
+  for (uint64_t value : values) {
+    uint64_t readValue = 0;
+
+    ASSERT_TRUE(ReadVarUint(read, bytes.data() + bytes.size(), readValue));
+    EXPECT_EQ(readValue, value);
+  }
+  EXPECT_EQ(read, bytes.data() + bytes.size());
+}
+
+TEST(FrameCodecTest, UnchangedFrame_Encode_OneByte) {
+  std::vector<AsciiCell> const cells = MakeCells(2000);
+  std::vector<unsigned char>   bytes;
+
+  EncodeFrameDelta(cells.data(), cells.data(), int(cells.size()), bytes);
+
+  EXPECT_EQ(bytes.size(), 1);
+}
+
+TEST(FrameCodecTest, RepeatedCells_Encode_RunIsCompressed) {
+  std::vector<AsciiCell> const previous(1000);
+  std::vector<AsciiCell> const current(1000, AsciiCell('#', 2, 3));
+  std::vector<unsigned char>   bytes;
+
+  EncodeFrameDelta(previous.data(), current.data(), int(current.size()), bytes);
+
+  EXPECT_LT(bytes.size(), 16);
+}
+
+TEST(FrameCodecTest, ScatteredChanges_EncodeThenDecode_CellsMatch) {
+  std::vector<AsciiCell> const previous = MakeCells(500);
+  std::vector<AsciiCell>       current  = previous;
+
+  current[0]   = AsciiCell('x', 1, 1);
+  current[3]   = AsciiCell('y', 2, 2);
+  current[250] = AsciiCell('z', 3, 3);
+  for (int i = 400; i < 480; ++i) {
+    current[i] = AsciiCell(' ', 0, 4);
+  }
+  current[499] = AsciiCell(char(200), 7, 0);
+
+  std::vector<unsigned char> bytes;
+  EncodeFrameDelta(previous.data(), current.data(), int(current.size()), bytes);
+
+  std::vector<AsciiCell> decoded = previous;
+  unsigned char const *  read    = bytes.data();
+
+  ASSERT_TRUE(DecodeFrameDelta(read, bytes.data() + bytes.size(), decoded.data(), int(decoded.size())));
+  EXPECT_EQ(decoded, current);
+  EXPECT_EQ(read, bytes.data() + bytes.size());
+}
+
+TEST(FrameCodecTest, TruncatedFrame_Decode_ReturnsFalse) {
+  std::vector<AsciiCell> const previous(100);
+  std::vector<AsciiCell> const current = MakeCells(100);
+  std::vector<unsigned char>   bytes;
+
+  EncodeFrameDelta(previous.data(), current.data(), int(current.size()), bytes);
+  bytes.resize(bytes.size() / 2);
+
+  std::vector<AsciiCell> decoded = previous;
+  unsigned char const *  read    = bytes.data();
+
+  EXPECT_FALSE(DecodeFrameDelta(read, bytes.data() + bytes.size(), decoded.data(), int(decoded.size())));
+}
+
+TEST(FrameCodecTest, FrameLargerThanGrid_Decode_ReturnsFalse) {
+  std::vector<AsciiCell> const previous(100);
+  std::vector<AsciiCell> const current = MakeCells(100);
+  std::vector<unsigned char>   bytes;
+
+  EncodeFrameDelta(previous.data(), current.data(), int(current.size()), bytes);
+
+  std::vector<AsciiCell> decoded(50);
+  unsigned char const *  read = bytes.data();
+
+  EXPECT_FALSE(DecodeFrameDelta(read, bytes.data() + bytes.size(), decoded.data(), int(decoded.size())));
+}
+
+TEST(FrameCodecTest, InputEvents_WriteThenRead_EventsMatch) {
+  AsciiInputEvent button;
+  button.type               = AsciiInputType::Button;
+  button.buttonEvent.button = AsciiButton::Escape;
+  button.buttonEvent.isDown = true;
+
+  AsciiInputEvent position;
+  position.type               = AsciiInputType::MousePosition;
+  position.mousePositionEvent = ivec2(-3, 140);
+
+  AsciiInputEvent scroll;
+  scroll.type             = AsciiInputType::MouseScroll;
+  scroll.mouseScrollEvent = -2;
+
+  std::vector<unsigned char> bytes;
+  WriteInputEvent(button, bytes);
+  WriteInputEvent(position, bytes);
+  WriteInputEvent(scroll, bytes);
+
+  unsigned char const * read = bytes.data();
+  unsigned char const * end  = bytes.data() + bytes.size();
+
+  AsciiInputEvent readButton;
+  AsciiInputEvent readPosition;
+  AsciiInputEvent readScroll;
+
+  ASSERT_TRUE(ReadInputEvent(read, end, readButton));
+  ASSERT_TRUE(ReadInputEvent(read, end, readPosition));
+  ASSERT_TRUE(ReadInputEvent(read, end, readScroll));
+  EXPECT_EQ(readButton.buttonEvent.button, AsciiButton::Escape);
+  EXPECT_TRUE(readButton.buttonEvent.isDown);
+  EXPECT_EQ(readPosition.mousePositionEvent, ivec2(-3, 140));
+  EXPECT_EQ(readScroll.mouseScrollEvent, -2);
+}
+
+TEST(FrameCodecTest, ResizeEvent_WriteThenRead_SizeMatches) {
+  AsciiInputEvent resize;
+  resize.type        = AsciiInputType::Resize;
+  resize.resizeEvent = ivec2(120, 40);
+
+  std::vector<unsigned char> bytes;
+  WriteInputEvent(resize, bytes);
+
+  unsigned char const * read = bytes.data();
+  AsciiInputEvent       readResize;
+
+  ASSERT_TRUE(ReadInputEvent(read, bytes.data() + bytes.size(), readResize));
+  EXPECT_EQ(readResize.type, AsciiInputType::Resize);
+  EXPECT_EQ(readResize.resizeEvent, ivec2(120, 40));
+  EXPECT_EQ(read, bytes.data() + bytes.size());
+}
+
+TEST(FrameCodecTest, Font_WriteThenRead_FontsMatch) {
+  AsciiFont font;
+  font.size = ivec2(8, 16);
+  for (int i = 0; i < PaletteColorCount; ++i) {
+    font.colors[i] = Color((unsigned char)(i * 7), 10, (unsigned char)(255 - i));
+  }
+  font.cycles[1] = PaletteCycle{ 8, 8, 50, true };
+
+  std::vector<unsigned char> bytes;
+  WriteFont(font, bytes);
+
+  AsciiFont             readFont;
+  unsigned char const * read = bytes.data();
+
+  ASSERT_TRUE(ReadFont(read, bytes.data() + bytes.size(), readFont));
+  EXPECT_EQ(readFont, font);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/FrameStats.h"
+#include "gtest/gtest.h"
+
+TEST(FrameStatsTest, NoFrames_GetStats_AllZero) {
+  FrameStatsRecorder recorder;
+
+  EXPECT_EQ(recorder.GetFrameCount(), 0);
+  EXPECT_EQ(recorder.GetFrame(0).drawNs, 0);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Draw).GetFrameCount(), 0);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Draw).GetPercentileNs(0.5f), 0);
+}
+
+TEST(FrameStatsTest, StatsAdded_EndFrame_FrameHoldsTotals) {
+  FrameStatsRecorder recorder;
+
+  recorder.Add(&AsciiFrameStats::drawNs, 100);
+  recorder.Add(&AsciiFrameStats::drawNs, 50);
+  recorder.Add(&AsciiFrameStats::inputEvents, 3);
+  recorder.EndFrame(0);
+
+  ASSERT_EQ(recorder.GetFrameCount(), 1);
+  EXPECT_EQ(recorder.GetFrame(0).drawNs, 150);
+  EXPECT_EQ(recorder.GetFrame(0).inputEvents, 3);
+  EXPECT_EQ(recorder.GetFrame(0).swapNs, 0);
+}
+
+TEST(FrameStatsTest, FramesEnded_GetFrame_NewestFirst) {
+  FrameStatsRecorder recorder;
+
+  for (int i = 1; i <= 3; ++i) {
+    recorder.Add(&AsciiFrameStats::uploadedCells, i);
+    recorder.EndFrame(0);
+  }
+
+  EXPECT_EQ(recorder.GetFrame(0).uploadedCells, 3);
+  EXPECT_EQ(recorder.GetFrame(1).uploadedCells, 2);
+  EXPECT_EQ(recorder.GetFrame(2).uploadedCells, 1);
+}
+
+TEST(FrameStatsTest, AgePastOldestFrame_GetFrame_OldestFrame) {
+  FrameStatsRecorder recorder;
+
+  for (int i = 1; i <= 3; ++i) {
+    recorder.Add(&AsciiFrameStats::uploadedCells, i);
+    recorder.EndFrame(0);
+  }
+
+  EXPECT_EQ(recorder.GetFrame(3).uploadedCells, 1);
+  EXPECT_EQ(recorder.GetFrame(FrameStatsRecorder::HistoryCapacity * 2).uploadedCells, 1);
+  EXPECT_EQ(recorder.GetFrame(-1).uploadedCells, 3);
+}
+
+TEST(FrameStatsTest, FramesEnded_GetFrameTimes_TimeBetweenEnds) {
+  FrameStatsRecorder recorder;
+
+  recorder.EndFrame(1000000);
+  recorder.EndFrame(3000000);
+  recorder.EndFrame(8000000);
+
+  EXPECT_EQ(recorder.GetFrame(2).frameNs, 0);
+  EXPECT_EQ(recorder.GetFrame(1).frameNs, 2000000);
+  EXPECT_EQ(recorder.GetFrame(0).frameNs, 5000000);
+
+  FrameTimeRecorder const & frameTimes = recorder.GetTimes(AsciiFrameTime::Frame);
+
+  EXPECT_EQ(frameTimes.GetFrameCount(), 2);
+  EXPECT_EQ(frameTimes.GetMinNs(), 2000000);
+  EXPECT_EQ(frameTimes.GetMaxNs(), 5000000);
+}
+
+TEST(FrameStatsTest, OneSlowFrameInHundred_GetPercentiles_OnlyTopPercentileIsSlow) {
+  FrameStatsRecorder recorder;
+
+  for (int i = 0; i < 99; ++i) {
+    recorder.Add(&AsciiFrameStats::drawNs, 100000);
+    recorder.EndFrame(0);
+  }
+  recorder.Add(&AsciiFrameStats::drawNs, 900000);
+  recorder.EndFrame(0);
+
+  FrameTimeRecorder const & drawTimes = recorder.GetTimes(AsciiFrameTime::Draw);
+
+  EXPECT_EQ(drawTimes.GetPercentileNs(0.5f), 110000);
+  EXPECT_EQ(drawTimes.GetPercentileNs(0.99f), 110000);
+  EXPECT_EQ(drawTimes.GetPercentileNs(1.0f), 900000);
+  EXPECT_EQ(drawTimes.GetMeanNs(), 108000);
+}
+
+TEST(FrameStatsTest, MoreFramesThanHistory_GetStats_OldestFramesDroppedFromHistoryOnly) {
+  FrameStatsRecorder recorder;
+
+  recorder.Add(&AsciiFrameStats::sleepNs, 5000);
+  recorder.EndFrame(0);
+  for (int i = 0; i < FrameStatsRecorder::HistoryCapacity; ++i) {
+    recorder.Add(&AsciiFrameStats::sleepNs, 10);
+    recorder.EndFrame(0);
+  }
+
+  EXPECT_EQ(recorder.GetFrameCount(), int(FrameStatsRecorder::HistoryCapacity));
+  EXPECT_EQ(recorder.GetFrame(FrameStatsRecorder::HistoryCapacity - 1).sleepNs, 10);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Sleep).GetMaxNs(), 5000);
+}
+
+TEST(FrameStatsTest, FramesEnded_Clear_StatsReset) {
+  FrameStatsRecorder recorder;
+
+  recorder.Add(&AsciiFrameStats::pollNs, 10);
+  recorder.EndFrame(0);
+  recorder.Add(&AsciiFrameStats::pollNs, 20);
+  recorder.Clear();
+  recorder.EndFrame(1000);
+
+  EXPECT_EQ(recorder.GetFrameCount(), 1);
+  EXPECT_EQ(recorder.GetFrame(0).pollNs, 0);
+  EXPECT_EQ(recorder.GetFrame(0).frameNs, 0);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Poll).GetFrameCount(), 1);
+}
+
+TEST(FrameStatsTest, EachTimeAdded_GetTimes_EachInItsOwnRecorder) {
+  FrameStatsRecorder recorder;
+
+  recorder.EndFrame(0);
+  recorder.Add(&AsciiFrameStats::drawNs, 20000);
+  recorder.Add(&AsciiFrameStats::swapNs, 30000);
+  recorder.Add(&AsciiFrameStats::pollNs, 40000);
+  recorder.Add(&AsciiFrameStats::sleepNs, 50000);
+  recorder.Add(&AsciiFrameStats::uploadedCells, 60000);
+  recorder.EndFrame(10000);
+
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Frame).GetMaxNs(), 10000);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Draw).GetMaxNs(), 20000);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Swap).GetMaxNs(), 30000);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Poll).GetMaxNs(), 40000);
+  EXPECT_EQ(recorder.GetTimes(AsciiFrameTime::Sleep).GetMaxNs(), 50000);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/FrameTimeRecorder.h"
+#include "gtest/gtest.h"
+
+TEST(FrameTimeRecorderTest, NoFrames_GetStats_AllZero) {
+  FrameTimeRecorder recorder;
+
+  EXPECT_EQ(recorder.GetFrameCount(), 0);
+  EXPECT_EQ(recorder.GetMeanNs(), 0);
+  EXPECT_EQ(recorder.GetPercentileNs(0.5f), 0);
+}
+
+TEST(FrameTimeRecorderTest, FramesAdded_GetMinMaxMean_MatchFrames) {
+  FrameTimeRecorder recorder;
+
+  recorder.AddFrame(16000000);
+  recorder.AddFrame(17000000);
+  recorder.AddFrame(18000000);
+
+  EXPECT_EQ(recorder.GetFrameCount(), 3);
+  EXPECT_EQ(recorder.GetMinNs(), 16000000);
+  EXPECT_EQ(recorder.GetMaxNs(), 18000000);
+  EXPECT_EQ(recorder.GetMeanNs(), 17000000);
+}
+
+TEST(FrameTimeRecorderTest, OneSlowFrameInHundred_GetPercentiles_OnlyTopPercentileIsSlow) {
+  FrameTimeRecorder recorder;
+
+  for (int i = 0; i < 99; ++i) {
+    recorder.AddFrame(16600000);
+  }
+  recorder.AddFrame(40000000);
+
+  EXPECT_NEAR(double(recorder.GetPercentileNs(0.5f)), 16600000.0, double(FrameTimeRecorder::BucketNs));
+  EXPECT_NEAR(double(recorder.GetPercentileNs(0.99f)), 16600000.0, double(FrameTimeRecorder::BucketNs));
+  EXPECT_EQ(recorder.GetPercentileNs(1.0f), 40000000);
+}
+
+TEST(FrameTimeRecorderTest, FrameLongerThanHistogram_GetPercentile_ReturnsMax) {
+  FrameTimeRecorder recorder;
+
+  recorder.AddFrame(FrameTimeRecorder::BucketNs * FrameTimeRecorder::BucketCount * 3);
+
+  EXPECT_EQ(recorder.GetPercentileNs(0.5f), FrameTimeRecorder::BucketNs * FrameTimeRecorder::BucketCount * 3);
+}
+
+TEST(FrameTimeRecorderTest, FramesAdded_Clear_StatsReset) {
+  FrameTimeRecorder recorder;
+
+  recorder.AddFrame(5000000);
+  recorder.Clear();
+  recorder.AddFrame(7000000);
+
+  EXPECT_EQ(recorder.GetFrameCount(), 1);
+  EXPECT_EQ(recorder.GetMinNs(), 7000000);
+}
@@ -0,0 +1,163 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/GlyphAtlas.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "Window/BlockFont.h"
+#include "gtest/gtest.h"
+
+namespace {
+  std::vector<unsigned char> MakeAtlasBytes(ivec2 const & glyphSize) {
+    std::vector<unsigned char> sheet(size_t(glyphSize.x) * glyphSize.y * 256);
+    for (size_t i = 0; i < sheet.size(); ++i) {
+      sheet[i] = (unsigned char)(i % 3 == 0 ? 255 : 0);
+    }
+
+    std::vector<unsigned char> bytes;
+    WriteGlyphAtlas(glyphSize, sheet.data(), bytes);
+
+    return bytes;
+  }
+
+  std::string WriteTempFile(std::string const & name, std::vector<unsigned char> const & bytes) {
+    std::string const path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream     file(path, std::ios::binary);
+
+    file.write(reinterpret_cast<char const *>(bytes.data()), std::streamsize(bytes.size()));
+
+    return path;
+  }
+}
+
+TEST(GlyphAtlasTest, WrittenAtlas_ParseGlyphAtlas_SizeAndSheetMatch) {
+  std::vector<unsigned char> const bytes = MakeAtlasBytes(ivec2(8, 16));
+  ivec2                            glyphSize;
+  unsigned char const *            sheet = nullptr;
+
+  ASSERT_TRUE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, sheet));
+  EXPECT_EQ(glyphSize, ivec2(8, 16));
+  EXPECT_EQ(sheet, bytes.data() + GlyphAtlasHeaderSize);
+  EXPECT_EQ(bytes.size(), size_t(GlyphAtlasHeaderSize + 8 * 16 * 256));
+}
+
+TEST(GlyphAtlasTest, WrittenAtlasWithPages_ParseGlyphAtlas_PagesFollowEachOther) {
+  std::vector<unsigned char> sheet(size_t(4) * 4 * 256 * 3);
+  for (size_t i = 0; i < sheet.size(); ++i) {
+    sheet[i] = (unsigned char)(i / (4 * 4 * 256));
+  }
+
+  std::vector<unsigned char> bytes;
+  WriteGlyphAtlas(ivec2(4, 4), sheet.data(), 3, bytes);
+
+  ivec2                 glyphSize;
+  int                   pageCount = 0;
+  unsigned char const * parsed    = nullptr;
+
+  ASSERT_TRUE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, pageCount, parsed));
+  EXPECT_EQ(pageCount, 3);
+  EXPECT_TRUE(std::equal(sheet.begin(), sheet.end(), parsed));
+
+  GlyphAtlas const atlas(glyphSize, parsed, pageCount);
+  EXPECT_EQ(atlas.GetGlyphCount(), 3 * GlyphAtlasPageGlyphCount);
+}
+
+TEST(GlyphAtlasTest, VersionOneAtlas_ParseGlyphAtlas_SinglePage) {
+  std::vector<unsigned char> bytes = MakeAtlasBytes(ivec2(8, 8));
+
+  // Version 1 headers are the same without the page count.
+  bytes[GlyphAtlasMagicSize] = 1;
+  bytes.erase(bytes.begin() + GlyphAtlasMagicSize + 12, bytes.begin() + GlyphAtlasHeaderSize);
+
+  ivec2                 glyphSize;
+  int                   pageCount = 0;
+  unsigned char const * sheet     = nullptr;
+
+  ASSERT_TRUE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, pageCount, sheet));
+  EXPECT_EQ(glyphSize, ivec2(8, 8));
+  EXPECT_EQ(pageCount, 1);
+  EXPECT_EQ(sheet, bytes.data() + GlyphAtlasMagicSize + 12);
+}
+
+TEST(GlyphAtlasTest, TooManyPages_ParseGlyphAtlas_Fails) {
+  std::vector<unsigned char> bytes = MakeAtlasBytes(ivec2(8, 8));
+  ivec2                      glyphSize;
+  unsigned char const *      sheet = nullptr;
+
+  bytes[GlyphAtlasMagicSize + 12] = GlyphAtlasMaxPageCount + 1;
+
+  EXPECT_FALSE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, sheet));
+}
+
+TEST(GlyphAtlasTest, TruncatedSheet_ParseGlyphAtlas_Fails) {
+  std::vector<unsigned char> const bytes = MakeAtlasBytes(ivec2(8, 8));
+  ivec2                            glyphSize;
+  unsigned char const *            sheet = nullptr;
+
+  EXPECT_FALSE(ParseGlyphAtlas(bytes.data(), bytes.size() - 1, glyphSize, sheet));
+}
+
+TEST(GlyphAtlasTest, WrongMagic_ParseGlyphAtlas_Fails) {
+  std::vector<unsigned char> bytes = MakeAtlasBytes(ivec2(8, 8));
+  ivec2                      glyphSize;
+  unsigned char const *      sheet = nullptr;
+
+  bytes[0] = 'X';
+
+  EXPECT_FALSE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, sheet));
+}
+
+TEST(GlyphAtlasTest, AtlasFile_Load_SheetMappedFromFile) {
+  std::vector<unsigned char> const bytes = MakeAtlasBytes(ivec2(6, 10));
+  std::string const                path  = WriteTempFile("GlyphAtlasTest.atlas", bytes);
+
+  std::shared_ptr<GlyphAtlas const> const atlas = GlyphAtlas::Load(path);
+
+  ASSERT_NE(atlas, nullptr);
+  EXPECT_EQ(atlas->GetGlyphSize(), ivec2(6, 10));
+  EXPECT_TRUE(std::equal(bytes.begin() + GlyphAtlasHeaderSize, bytes.end(), atlas->GetGlyphSheet()));
+
+  std::filesystem::remove(path);
+}
+
+TEST(GlyphAtlasTest, MissingFile_Load_ReturnsNull) {
+  EXPECT_EQ(GlyphAtlas::Load((std::filesystem::temp_directory_path() / "GlyphAtlasTestMissing.atlas").string()), nullptr);
+}
+
+TEST(GlyphAtlasTest, AtlasSetThenCleared_GetGlyphSize_FallsBackToCompiledInFont) {
+  std::vector<unsigned char> const bytes = MakeAtlasBytes(ivec2(5, 7));
+  ivec2                            glyphSize;
+  unsigned char const *            sheet = nullptr;
+
+  ASSERT_TRUE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, sheet));
+
+  SetGlyphAtlas(std::make_shared<GlyphAtlas>(glyphSize, sheet));
+  EXPECT_EQ(GetGlyphSize(), ivec2(5, 7));
+  EXPECT_EQ(GetGlyphSheet(), sheet);
+
+  SetGlyphAtlas(nullptr);
+  EXPECT_EQ(GetGlyphSize(), GetBlockFontGlyphSize());
+  EXPECT_EQ(GetGlyphSheet(), GetBlockFontSheet());
+}
+
+TEST(GlyphAtlasTest, AtlasReplaced_GlyphAtlasCacheGet_PicksUpNewAtlas) {
+  std::vector<unsigned char> const bytes = MakeAtlasBytes(ivec2(5, 7));
+  ivec2                            glyphSize;
+  unsigned char const *            sheet = nullptr;
+
+  ASSERT_TRUE(ParseGlyphAtlas(bytes.data(), bytes.size(), glyphSize, sheet));
+
+  GlyphAtlasCache                         cache;
+  std::shared_ptr<GlyphAtlas const> const atlas = std::make_shared<GlyphAtlas>(glyphSize, sheet);
+
+  SetGlyphAtlas(atlas);
+  EXPECT_EQ(cache.Get(), atlas);
+  EXPECT_EQ(cache.Get(), GetGlyphAtlas());
+
+  SetGlyphAtlas(nullptr);
+  EXPECT_NE(cache.Get(), atlas);
+  EXPECT_EQ(cache.Get(), GetGlyphAtlas());
+}
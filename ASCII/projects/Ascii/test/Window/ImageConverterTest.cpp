@@ -0,0 +1,129 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/ImageConverter.h"
+
+#include <random>
+
+#include "Window/SoftwareWindow.h"
+#include "gtest/gtest.h"
+
+namespace {
+  std::vector<Color> GetTestPalette(void) {
+    return { Color::Black, Color::White, Color::Red, Color::Blue };
+  }
+
+  AsciiFont GetTestFont(void) {
+    std::vector<Color> const palette = GetTestPalette();
+
+    AsciiFont font;
+    std::copy(palette.begin(), palette.end(), font.colors);
+
+    return font;
+  }
+}
+
+TEST(ImageConverterTest, SolidImage_Convert_SpacesOnNearestColor) {
+  AsciiImageConverter converter;
+  Grid<AsciiCell, 2>  cells(ivec2(3, 2));
+
+  converter.Convert(Grid<Color, 2>(ivec2(30, 20), Color(250, 10, 5)), GetTestPalette(), cells);
+
+  for (AsciiCell const & cell : cells) {
+    EXPECT_EQ(cell.character, ' ');
+    EXPECT_EQ(cell.backgroundColor, 2);
+  }
+}
+
+TEST(ImageConverterTest, SmallSolidImage_ConvertUpscaled_SpacesOnNearestColor) {
+  AsciiImageConverter converter;
+  Grid<AsciiCell, 2>  cells(ivec2(20, 10));
+
+  converter.Convert(Grid<Color, 2>(ivec2(16, 8), Color(250, 10, 5)), GetTestPalette(), cells);
+
+  for (AsciiCell const & cell : cells) {
+    EXPECT_EQ(cell.character, ' ');
+    EXPECT_EQ(cell.backgroundColor, 2);
+  }
+}
+
+TEST(ImageConverterTest, TwoPixelImage_ConvertUpscaled_EachHalfTakesItsPixel) {
+  Grid<Color, 2> image(ivec2(2, 1));
+  image[ivec2(0, 0)] = Color::Red;
+  image[ivec2(1, 0)] = Color::Blue;
+
+  AsciiImageConverter converter;
+  Grid<AsciiCell, 2>  cells(ivec2(4, 2));
+
+  converter.Convert(image, GetTestPalette(), cells);
+
+  for (ivec2 i; i != cells.GetSize(); i = cells.GetNextCoord(i, cells.GetSize())) {
+    EXPECT_EQ(cells[i].character, ' ');
+    EXPECT_EQ(cells[i].backgroundColor, i.x < 2 ? 2 : 3);
+  }
+}
+
+TEST(ImageConverterTest, RasterizedCells_Convert_SameCellsBack) {
+  Grid<AsciiCell, 2> drawn(ivec2(3, 1));
+  drawn[ivec2(0, 0)] = AsciiCell('A', 1, 0);
+  drawn[ivec2(1, 0)] = AsciiCell('#', 2, 3);
+  drawn[ivec2(2, 0)] = AsciiCell('@', 3, 1);
+
+  SoftwareAsciiWindow window;
+  window.SetFont(GetTestFont());
+  window.Draw(drawn);
+
+  AsciiImageConverter converter;
+  Grid<AsciiCell, 2>  cells(ivec2(3, 1));
+
+  converter.Convert(window.GetFramebuffer(), GetTestPalette(), cells);
+
+  for (int i = 0; i < drawn.Count(); ++i) {
+    EXPECT_EQ(cells.Data()[i], drawn.Data()[i]);
+  }
+}
+
+TEST(ImageConverterTest, NoisyImage_ConvertOnThreads_MatchesSingleThread) {
+  Grid<Color, 2> image(ivec2(97, 61));
+  std::mt19937   random(7);
+
+  for (Color & pixel : image) {
+    pixel = Color((unsigned char)random(), (unsigned char)random(), (unsigned char)random());
+  }
+
+  AsciiImageConverter converter;
+  Grid<AsciiCell, 2>  single(ivec2(20, 13));
+  Grid<AsciiCell, 2>  threaded(ivec2(20, 13));
+
+  converter.SetThreadCount(1);
+  converter.Convert(image, GetTestPalette(), single);
+  converter.SetThreadCount(4);
+  converter.Convert(image, GetTestPalette(), threaded);
+
+  for (int i = 0; i < single.Count(); ++i) {
+    EXPECT_EQ(single.Data()[i], threaded.Data()[i]);
+  }
+}
+
+TEST(ImageConverterTest, PaletteLongerThanFont_Convert_OnlyFontColorsUsed) {
+  AsciiImageConverter converter;
+  Grid<AsciiCell, 2>  cells(ivec2(3, 2));
+  std::vector<Color>  palette(PaletteColorCount, Color::Black);
+
+  palette.push_back(Color::Red);
+
+  converter.Convert(Grid<Color, 2>(ivec2(30, 20), Color::Red), palette, cells);
+
+  for (AsciiCell const & cell : cells) {
+    EXPECT_LT(cell.foregroundColor, PaletteColorCount);
+    EXPECT_LT(cell.backgroundColor, PaletteColorCount);
+  }
+}
+
+TEST(ImageConverterTest, CompiledInFont_GetCandidateCount_DropsDuplicateGlyphs) {
+  AsciiImageConverter converter;
+
+  EXPECT_GT(converter.GetCandidateCount(), 1);
+  EXPECT_LT(converter.GetCandidateCount(), 256);
+}
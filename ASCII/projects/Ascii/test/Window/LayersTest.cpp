@@ -0,0 +1,99 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/Layers.h"
+#include "gtest/gtest.h"
+
+TEST(LayersTest, NoLayers_CompositeLayers_BlankCellsInColorZero) {
+  Grid<AsciiCell, 2> grid;
+
+  CompositeLayers(ivec2(3, 2), {}, grid);
+
+  ASSERT_EQ(grid.GetSize(), ivec2(3, 2));
+  EXPECT_EQ(grid[ivec2(2, 1)], AsciiCell(' ', 0, 0));
+}
+
+TEST(LayersTest, OpaqueUpperLayer_CompositeLayers_UpperCellsReplaceLower) {
+  Grid<AsciiCell, 2> const map(ivec2(4, 4), AsciiCell('.', 1, 2));
+  Grid<AsciiCell, 2> const menu(ivec2(2, 1), AsciiCell('m', 3, 4));
+  AsciiLayer const         layers[] = { AsciiLayer(map), AsciiLayer(menu, ivec2(1, 2)) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(4, 4), layers, grid);
+
+  EXPECT_EQ(grid[ivec2(0, 2)], AsciiCell('.', 1, 2));
+  EXPECT_EQ(grid[ivec2(1, 2)], AsciiCell('m', 3, 4));
+  EXPECT_EQ(grid[ivec2(2, 2)], AsciiCell('m', 3, 4));
+  EXPECT_EQ(grid[ivec2(3, 2)], AsciiCell('.', 1, 2));
+}
+
+TEST(LayersTest, TransparentBackground_CompositeLayers_GlyphKeepsLowerBackground) {
+  Grid<AsciiCell, 2> const map(ivec2(2, 2), AsciiCell('.', 1, 2));
+  Grid<AsciiCell, 2> const text(ivec2(1, 1), AsciiCell('t', 5, TransparentColor));
+  AsciiLayer const         layers[] = { AsciiLayer(map), AsciiLayer(text) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(2, 2), layers, grid);
+
+  EXPECT_EQ(grid[ivec2(0, 0)], AsciiCell('t', 5, 2));
+}
+
+TEST(LayersTest, TransparentForeground_CompositeLayers_GlyphTakesLowerBackground) {
+  Grid<AsciiCell, 2> const map(ivec2(2, 2), AsciiCell('.', 1, 2));
+  Grid<AsciiCell, 2> const stencil(ivec2(1, 1), AsciiCell('s', TransparentColor, 6));
+  AsciiLayer const         layers[] = { AsciiLayer(map), AsciiLayer(stencil) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(2, 2), layers, grid);
+
+  EXPECT_EQ(grid[ivec2(0, 0)], AsciiCell('s', 2, 6));
+}
+
+TEST(LayersTest, FullyTransparentCell_CompositeLayers_LowerCellUnchanged) {
+  Grid<AsciiCell, 2> const map(ivec2(2, 2), AsciiCell('.', 1, 2));
+  Grid<AsciiCell, 2> const clear(ivec2(2, 2), AsciiCell('x', TransparentColor, TransparentColor));
+  AsciiLayer const         layers[] = { AsciiLayer(map), AsciiLayer(clear) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(2, 2), layers, grid);
+
+  EXPECT_EQ(grid[ivec2(1, 1)], AsciiCell('.', 1, 2));
+}
+
+TEST(LayersTest, LayerPartlyOutsideWindow_CompositeLayers_LayerIsClipped) {
+  Grid<AsciiCell, 2> const overlay(ivec2(3, 3), AsciiCell('o', 1, 1));
+  AsciiLayer const         layers[] = { AsciiLayer(overlay, ivec2(-1, 2)) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(4, 4), layers, grid);
+
+  EXPECT_EQ(grid[ivec2(0, 1)], AsciiCell());
+  EXPECT_EQ(grid[ivec2(0, 2)], AsciiCell('o', 1, 1));
+  EXPECT_EQ(grid[ivec2(1, 3)], AsciiCell('o', 1, 1));
+  EXPECT_EQ(grid[ivec2(2, 3)], AsciiCell());
+}
+
+TEST(LayersTest, LayerEntirelyOutsideWindow_CompositeLayers_NothingDrawn) {
+  Grid<AsciiCell, 2> const overlay(ivec2(2, 2), AsciiCell('o', 1, 1));
+  AsciiLayer const         layers[] = { AsciiLayer(overlay, ivec2(10, -10)) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(4, 4), layers, grid);
+
+  for (AsciiCell const & cell : grid) {
+    EXPECT_EQ(cell, AsciiCell());
+  }
+}
+
+TEST(LayersTest, LayerWithPaletteBank_CompositeLayers_ColorsShiftedIntoBank) {
+  Grid<AsciiCell, 2> const map(ivec2(2, 1), AsciiCell('.', 1, 2));
+  Grid<AsciiCell, 2> const text(ivec2(1, 1), AsciiCell('t', 5, TransparentColor));
+  AsciiLayer const         layers[] = { AsciiLayer(map, ivec2(0, 0), 3), AsciiLayer(text, ivec2(0, 0), 1) };
+  Grid<AsciiCell, 2>       grid;
+
+  CompositeLayers(ivec2(2, 1), layers, grid);
+
+  EXPECT_EQ(grid[ivec2(0, 0)], AsciiCell('t', GetBankColor(1, 5), GetBankColor(3, 2)));
+  EXPECT_EQ(grid[ivec2(1, 0)], AsciiCell('.', GetBankColor(3, 1), GetBankColor(3, 2)));
+}
@@ -0,0 +1,71 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/PackedCells.h"
+#include "gtest/gtest.h"
+
+TEST(PackedCellsTest, WidestValues_AsciiPackedCell_EachFieldKept) {
+  AsciiPackedCell const cell(PackedGlyphCount - 1, PackedColorCount - 2, PackedColorCount - 1);
+
+  EXPECT_EQ(cell.GetGlyph(), PackedGlyphCount - 1);
+  EXPECT_EQ(cell.GetForegroundColor(), PackedColorCount - 2);
+  EXPECT_EQ(cell.GetBackgroundColor(), PackedColorCount - 1);
+}
+
+TEST(PackedCellsTest, GlyphTooBig_AsciiPackedCell_ColorsUntouched) {
+  AsciiPackedCell const cell(PackedGlyphCount + 5, 7, 9);
+
+  EXPECT_EQ(cell.GetGlyph(), 5);
+  EXPECT_EQ(cell.GetForegroundColor(), 7);
+  EXPECT_EQ(cell.GetBackgroundColor(), 9);
+}
+
+TEST(PackedCellsTest, AsciiCells_PackThenUnpack_SameCells) {
+  AsciiCell const cells[] = {
+    AsciiCell('a', 1, 2),
+    AsciiCell(char(0xDB), 254, 0),
+    AsciiCell('#', TransparentColor, 3),
+    AsciiCell(' ', 4, TransparentColor),
+  };
+
+  for (AsciiCell const & cell : cells) {
+    EXPECT_EQ(UnpackCell(PackCell(cell)), cell);
+  }
+}
+
+TEST(PackedCellsTest, TransparentColors_PackCell_PackedTransparentColor) {
+  AsciiPackedCell const cell = PackCell(AsciiCell('x', TransparentColor, TransparentColor));
+
+  EXPECT_EQ(cell.GetGlyph(), 'x');
+  EXPECT_EQ(cell.GetForegroundColor(), PackedTransparentColor);
+  EXPECT_EQ(cell.GetBackgroundColor(), PackedTransparentColor);
+}
+
+TEST(PackedCellsTest, GlyphPastFirstPage_UnpackCell_FallbackCharacter) {
+  EXPECT_EQ(UnpackCell(AsciiPackedCell(256 + 'a', 1, 2)), AsciiCell(UnpackedFallbackCharacter, 1, 2));
+}
+
+TEST(PackedCellsTest, ColorsPastByte_UnpackCell_WrappedToSamePaletteEntry) {
+  AsciiCell const cell = UnpackCell(AsciiPackedCell('a', 255, 300));
+
+  EXPECT_EQ(cell.foregroundColor, 255 % PaletteColorCount);
+  EXPECT_EQ(cell.backgroundColor, 300 % PaletteColorCount);
+}
+
+TEST(PackedCellsTest, Grid_PackCellsThenUnpackCells_SameGrid) {
+  Grid<AsciiCell, 2> cells(ivec2(3, 2), AsciiCell('.', 1, 0));
+  cells[ivec2(2, 1)] = AsciiCell('@', 2, TransparentColor);
+
+  Grid<AsciiPackedCell, 2> packed;
+  Grid<AsciiCell, 2>       unpacked;
+
+  PackCells(cells, packed);
+  UnpackCells(packed, unpacked);
+
+  ASSERT_EQ(packed.GetSize(), ivec2(3, 2));
+  EXPECT_EQ(packed[ivec2(2, 1)], AsciiPackedCell('@', 2, PackedTransparentColor));
+
+  ASSERT_EQ(unpacked.GetSize(), ivec2(3, 2));
+  EXPECT_TRUE(std::equal(cells.begin(), cells.end(), unpacked.begin()));
+}
@@ -0,0 +1,61 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include "Window/Palette.h"
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+namespace {
+  AsciiFont GetCyclingFont(bool isSmooth) {
+    AsciiFont font;
+    font.colors[8]  = Color(0, 0, 0);
+    font.colors[9]  = Color(100, 0, 0);
+    font.colors[10] = Color(200, 0, 0);
+    font.cycles[0]  = PaletteCycle{ 8, 3, 100, isSmooth };
+
+    return font;
+  }
+}
+
+TEST(PaletteTest, NoCycles_EvaluatePalette_ColorsUnchanged) {
+  AsciiFont font;
+  font.colors[3] = Color::Red;
+
+  Color palette[PaletteColorCount];
+  EvaluatePalette(font, 12345, palette);
+
+  EXPECT_FALSE(IsPaletteAnimated(font));
+  EXPECT_TRUE(std::equal(palette, palette + PaletteColorCount, font.colors));
+}
+
+TEST(PaletteTest, SteppedCycle_EvaluatePalette_ColorsRotateEachStep) {
+  AsciiFont const font = GetCyclingFont(false);
+  Color           palette[PaletteColorCount];
+
+  EvaluatePalette(font, 150, palette);
+
+  EXPECT_TRUE(IsPaletteAnimated(font));
+  EXPECT_EQ(palette[8], Color(100, 0, 0));
+  EXPECT_EQ(palette[9], Color(200, 0, 0));
+  EXPECT_EQ(palette[10], Color(0, 0, 0));
+  EXPECT_EQ(palette[11], font.colors[11]);
+}
+
+TEST(PaletteTest, SmoothCycle_EvaluatePalette_BlendsTowardNextColor) {
+  AsciiFont const font = GetCyclingFont(true);
+  Color           palette[PaletteColorCount];
+
+  EvaluatePalette(font, 50, palette);
+
+  EXPECT_EQ(palette[8], Color(50, 0, 0));
+  EXPECT_EQ(palette[10], Color(100, 0, 0));
+}
+
+TEST(PaletteTest, CycleOutsidePalette_IsPaletteCycleActive_False) {
+  EXPECT_FALSE(IsPaletteCycleActive(PaletteCycle{ PaletteColorCount - 2, 3, 100, false }));
+  EXPECT_FALSE(IsPaletteCycleActive(PaletteCycle{ 0, 4, 0, false }));
+  EXPECT_TRUE(IsPaletteCycleActive(PaletteCycle{ PaletteColorCount - 3, 3, 100, false }));
+}
@@ -0,0 +1,80 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <sstream>
+
+#include "Window/RecordingWindow.h"
+#include "Window/SoftwareWindow.h"
+#include "gtest/gtest.h"
+
+TEST(RecordingWindowTest, FrameDrawn_Draw_WrappedWindowDraws) {
+  auto                 software = std::make_shared<SoftwareAsciiWindow>();
+  auto                 output   = std::make_shared<std::stringstream>();
+  RecordingAsciiWindow window(software, output);
+
+  window.Draw(Grid<AsciiCell, 2>(ivec2(4, 3), AsciiCell('a', 1, 0)));
+
+  EXPECT_EQ(software->GetRasterizedCells(), 12);
+}
+
+TEST(RecordingWindowTest, SameFrameDrawnRepeatedly_Draw_EachFrameIsTiny) {
+  auto                 software = std::make_shared<SoftwareAsciiWindow>();
+  auto                 output   = std::make_shared<std::stringstream>();
+  RecordingAsciiWindow window(software, output);
+
+  Grid<AsciiCell, 2> const grid(ivec2(80, 40), AsciiCell('.', 2, 0));
+
+  window.Draw(grid);
+  int64_t const firstFrameBytes = window.GetRecordedBytes();
+
+  for (int i = 0; i < 100; ++i) {
+    window.Draw(grid);
+  }
+
+  EXPECT_LE(window.GetRecordedBytes() - firstFrameBytes, 100 * 8);
+}
+
+TEST(RecordingWindowTest, FramesRecorded_Flush_OutputHoldsEveryByte) {
+  auto output = std::make_shared<std::stringstream>();
+
+  int64_t recordedBytes = 0;
+  {
+    RecordingAsciiWindow window(std::make_shared<SoftwareAsciiWindow>(), output);
+
+    window.Draw(Grid<AsciiCell, 2>(ivec2(10, 10)));
+    recordedBytes = window.GetRecordedBytes();
+  }
+
+  EXPECT_EQ(int64_t(output->str().size()), recordedBytes);
+  EXPECT_EQ(output->str().compare(0, RecordingMagicSize, RecordingMagic), 0);
+}
+
+TEST(RecordingWindowTest, InputQueued_DrainInput_EventsPassedThrough) {
+  auto                 software = std::make_shared<SoftwareAsciiWindow>();
+  RecordingAsciiWindow window(software, std::make_shared<std::stringstream>());
+
+  AsciiInputEvent event;
+  event.type             = AsciiInputType::MouseScroll;
+  event.mouseScrollEvent = 3;
+  software->QueueInput(event);
+
+  std::span<AsciiInputEvent const> const events = window.DrainInput();
+
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events[0].mouseScrollEvent, 3);
+}
+
+TEST(RecordingWindowTest, LayersDrawn_DrawLayers_WrappedWindowGetsLayers) {
+  auto                 software = std::make_shared<SoftwareAsciiWindow>();
+  RecordingAsciiWindow window(software, std::make_shared<std::stringstream>());
+
+  Grid<AsciiCell, 2> const map(ivec2(6, 4), AsciiCell('.', 1, 0));
+  Grid<AsciiCell, 2> const menu(ivec2(2, 2), AsciiCell('m', 2, 3));
+  AsciiLayer const         layers[] = { AsciiLayer(map), AsciiLayer(menu, ivec2(1, 1)) };
+
+  window.DrawLayers(ivec2(6, 4), layers);
+
+  EXPECT_EQ(software->GetRasterizedCells(), 24);
+  EXPECT_GT(window.GetRecordedBytes(), RecordingMagicSize);
+}
@@ -0,0 +1,240 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "Window/RecordingWindow.h"
+#include "Window/ReplayPlayer.h"
+#include "Window/SoftwareWindow.h"
+#include "gtest/gtest.h"
+
+namespace {
+  Grid<AsciiCell, 2> MakeFrame(ivec2 size, int frame) {
+    Grid<AsciiCell, 2> grid(size, AsciiCell(' ', 0, 1));
+
+    for (int i = frame; i < grid.Count(); i += 7) {
+      grid.Data()[i] = AsciiCell(char('A' + frame % 26), frame % 8, 1);
+    }
+
+    return grid;
+  }
+
+  bool AreFramesEqual(Grid<AsciiCell, 2> const & lhs, Grid<AsciiCell, 2> const & rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+}
+
+TEST(ReplayPlayerTest, NotARecording_Construct_IsNotValid) {
+  auto         input = std::make_shared<std::stringstream>("definitely not a recording");
+  ReplayPlayer player(std::make_shared<SoftwareAsciiWindow>(), input);
+
+  EXPECT_FALSE(player.IsValid());
+  EXPECT_FALSE(player.Step());
+}
+
+TEST(ReplayPlayerTest, FramesRecorded_PlayAtMaxSpeed_LastFrameMatches) {
+  auto stream = std::make_shared<std::stringstream>();
+
+  Grid<AsciiCell, 2> lastFrame;
+  {
+    RecordingAsciiWindow recorder(std::make_shared<SoftwareAsciiWindow>(), stream);
+
+    for (int i = 0; i < 20; ++i) {
+      lastFrame = MakeFrame(ivec2(30, 10), i);
+      recorder.Draw(lastFrame);
+    }
+  }
+
+  auto         replayWindow = std::make_shared<SoftwareAsciiWindow>();
+  ReplayPlayer player(replayWindow, stream);
+
+  ASSERT_TRUE(player.IsValid());
+  player.Play(ReplaySpeed::Max);
+
+  EXPECT_EQ(player.GetFrameCount(), 20);
+  EXPECT_TRUE(AreFramesEqual(player.GetFrame(), lastFrame));
+  EXPECT_EQ(replayWindow->GetRunMs(), 0);
+}
+
+TEST(ReplayPlayerTest, FrameSizeChanges_Play_FramesMatch) {
+  auto stream = std::make_shared<std::stringstream>();
+
+  Grid<AsciiCell, 2> const smallFrame = MakeFrame(ivec2(5, 5), 1);
+  Grid<AsciiCell, 2> const largeFrame = MakeFrame(ivec2(12, 9), 2);
+  {
+    RecordingAsciiWindow recorder(std::make_shared<SoftwareAsciiWindow>(), stream);
+
+    recorder.Draw(smallFrame);
+    recorder.Draw(largeFrame);
+  }
+
+  ReplayPlayer player(std::make_shared<SoftwareAsciiWindow>(), stream);
+
+  // The font the recording started with.
+  ASSERT_TRUE(player.Step());
+  EXPECT_EQ(player.GetFrameCount(), 0);
+
+  ASSERT_TRUE(player.Step());
+  EXPECT_TRUE(AreFramesEqual(player.GetFrame(), smallFrame));
+  ASSERT_TRUE(player.Step());
+  EXPECT_TRUE(AreFramesEqual(player.GetFrame(), largeFrame));
+  EXPECT_FALSE(player.Step());
+}
+
+TEST(ReplayPlayerTest, FramesRecordedOverTime_PlayAtOriginalSpeed_ClockMatchesRecording) {
+  auto stream = std::make_shared<std::stringstream>();
+  {
+    auto                 recordWindow = std::make_shared<SoftwareAsciiWindow>();
+    RecordingAsciiWindow recorder(recordWindow, stream);
+
+    for (int i = 0; i < 5; ++i) {
+      recorder.Draw(MakeFrame(ivec2(8, 8), i));
+      recorder.Sleep(16);
+    }
+  }
+
+  auto         replayWindow = std::make_shared<SoftwareAsciiWindow>();
+  ReplayPlayer player(replayWindow, stream);
+
+  player.Play(ReplaySpeed::Original);
+
+  EXPECT_EQ(replayWindow->GetRunMs(), 4 * 16);
+}
+
+TEST(ReplayPlayerTest, FontAndInputRecorded_Play_FontAppliedAndInputAvailable) {
+  auto stream = std::make_shared<std::stringstream>();
+
+  AsciiFont font;
+  font.colors[3] = Color(10, 20, 30);
+  {
+    auto                 recordWindow = std::make_shared<SoftwareAsciiWindow>();
+    RecordingAsciiWindow recorder(recordWindow, stream);
+
+    AsciiInputEvent event;
+    event.type               = AsciiInputType::Button;
+    event.buttonEvent.button = AsciiButton::Space;
+    event.buttonEvent.isDown = true;
+    recordWindow->QueueInput(event);
+
+    recorder.SetFont(font);
+    recorder.DrainInput();
+  }
+
+  auto         replayWindow = std::make_shared<SoftwareAsciiWindow>();
+  ReplayPlayer player(replayWindow, stream);
+
+  player.Play(ReplaySpeed::Max);
+
+  EXPECT_EQ(replayWindow->GetFont(), font);
+  ASSERT_EQ(player.GetLastInput().size(), 1);
+  EXPECT_EQ(player.GetLastInput()[0].buttonEvent.button, AsciiButton::Space);
+}
+
+TEST(ReplayPlayerTest, FontSetBeforeRecording_Play_FontApplied) {
+  auto stream = std::make_shared<std::stringstream>();
+
+  AsciiFont font;
+  font.colors[5] = Color(40, 50, 60);
+  {
+    auto recordWindow = std::make_shared<SoftwareAsciiWindow>();
+    recordWindow->SetFont(font);
+
+    RecordingAsciiWindow recorder(recordWindow, stream);
+    recorder.Draw(MakeFrame(ivec2(4, 4), 0));
+  }
+
+  auto         replayWindow = std::make_shared<SoftwareAsciiWindow>();
+  ReplayPlayer player(replayWindow, stream);
+
+  player.Play(ReplaySpeed::Max);
+
+  EXPECT_EQ(replayWindow->GetFont(), font);
+  EXPECT_EQ(player.GetFrameCount(), 1);
+}
+
+TEST(ReplayPlayerTest, VersionOneRecording_Play_FontAndFrameApplied) {
+  std::vector<unsigned char> bytes(RecordingMagic, RecordingMagic + RecordingMagicSize);
+  WriteVarUint(1, bytes);
+
+  // Version 1 fonts are the size as zig-zag varints and FontColorCount colors.
+  AsciiFont                  font;
+  std::vector<unsigned char> payload = { 16, 32 };
+  for (int i = 0; i < FontColorCount; ++i) {
+    font.colors[i] = Color(i, i * 2, i * 3);
+    payload.insert(payload.end(), { (unsigned char)(i), (unsigned char)(i * 2), (unsigned char)(i * 3) });
+  }
+  font.size = ivec2(8, 16);
+
+  bytes.emplace_back((unsigned char)(RecordType::Font));
+  WriteVarUint(0, bytes);
+  WriteVarUint(payload.size(), bytes);
+  bytes.insert(bytes.end(), payload.begin(), payload.end());
+
+  Grid<AsciiCell, 2> const frame = MakeFrame(ivec2(6, 3), 2);
+  Grid<AsciiCell, 2> const blank(frame.GetSize());
+
+  payload.clear();
+  WriteVarUint(6, payload);
+  WriteVarUint(3, payload);
+  EncodeFrameDelta(blank.Data(), frame.Data(), frame.Count(), payload);
+
+  bytes.emplace_back((unsigned char)(RecordType::Frame));
+  WriteVarUint(0, bytes);
+  WriteVarUint(payload.size(), bytes);
+  bytes.insert(bytes.end(), payload.begin(), payload.end());
+
+  auto         replayWindow = std::make_shared<SoftwareAsciiWindow>();
+  ReplayPlayer player(replayWindow, std::make_shared<std::stringstream>(std::string(bytes.begin(), bytes.end())));
+
+  ASSERT_TRUE(player.IsValid());
+  player.Play(ReplaySpeed::Max);
+
+  EXPECT_EQ(replayWindow->GetFont(), font);
+  EXPECT_TRUE(AreFramesEqual(player.GetFrame(), frame));
+}
+
+TEST(ReplayPlayerTest, NewerVersion_Construct_IsNotValid) {
+  std::vector<unsigned char> bytes(RecordingMagic, RecordingMagic + RecordingMagicSize);
+  WriteVarUint(RecordingVersion + 1, bytes);
+
+  ReplayPlayer player(std::make_shared<SoftwareAsciiWindow>(), std::make_shared<std::stringstream>(std::string(bytes.begin(), bytes.end())));
+
+  EXPECT_FALSE(player.IsValid());
+}
+
+TEST(ReplayPlayerTest, PayloadSizePastEndOfInput_Step_Fails) {
+  std::vector<unsigned char> bytes(RecordingMagic, RecordingMagic + RecordingMagicSize);
+  WriteVarUint(RecordingVersion, bytes);
+
+  bytes.emplace_back((unsigned char)(RecordType::Frame));
+  WriteVarUint(0, bytes);
+  WriteVarUint(uint64_t(1) << 60, bytes);
+  bytes.insert(bytes.end(), 16, 0);
+
+  ReplayPlayer player(std::make_shared<SoftwareAsciiWindow>(), std::make_shared<std::stringstream>(std::string(bytes.begin(), bytes.end())));
+
+  ASSERT_TRUE(player.IsValid());
+  EXPECT_FALSE(player.Step());
+}
+
+TEST(ReplayPlayerTest, FrameTooLarge_Step_Fails) {
+  std::vector<unsigned char> bytes(RecordingMagic, RecordingMagic + RecordingMagicSize);
+  WriteVarUint(RecordingVersion, bytes);
+
+  std::vector<unsigned char> payload;
+  WriteVarUint(1 << 20, payload);
+  WriteVarUint(1 << 20, payload);
+
+  bytes.emplace_back((unsigned char)(RecordType::Frame));
+  WriteVarUint(0, bytes);
+  WriteVarUint(payload.size(), bytes);
+  bytes.insert(bytes.end(), payload.begin(), payload.end());
+
+  ReplayPlayer player(std::make_shared<SoftwareAsciiWindow>(), std::make_shared<std::stringstream>(std::string(bytes.begin(), bytes.end())));
+
+  ASSERT_TRUE(player.IsValid());
+  EXPECT_FALSE(player.Step());
+  EXPECT_EQ(player.GetFrame().Count(), 0);
+}
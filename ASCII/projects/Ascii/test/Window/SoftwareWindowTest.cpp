@@ -0,0 +1,360 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <algorithm>
+
+#include "Window/SoftwareWindow.h"
+#include "Window/BlockFont.h"
+#include "Window/PackedCells.h"
+#include "gtest/gtest.h"
+
+namespace {
+  AsciiFont GetTestFont(void) {
+    AsciiFont font;
+    font.colors[0] = Color::Black;
+    font.colors[1] = Color::White;
+    font.colors[2] = Color::Red;
+
+    return font;
+  }
+
+  bool IsGlyphPixelSet(char character, ivec2 const & pixel) {
+    ivec2 const glyphSize  = GetGlyphSize();
+    int const   glyph      = (unsigned char)character;
+    ivec2 const sheetPixel = ivec2(glyph % 16, glyph / 16) * glyphSize + pixel;
+
+    return GetGlyphSheet()[sheetPixel.y * glyphSize.x * 16 + sheetPixel.x] != 0;
+  }
+}
+
+TEST(SoftwareWindowTest, GridDrawn_GetFramebuffer_SizeIsGridTimesGlyphSize) {
+  SoftwareAsciiWindow window;
+
+  window.Draw(Grid<AsciiCell, 2>(ivec2(5, 3)));
+
+  EXPECT_EQ(window.GetFramebuffer().GetSize(), ivec2(5, 3) * GetGlyphSize());
+}
+
+TEST(SoftwareWindowTest, WindowWithAtlas_GetFramebuffer_SizeUsesAtlasGlyphSize) {
+  std::vector<unsigned char> const sheet(4 * 6 * 256, 255);
+
+  SoftwareAsciiWindow window(std::make_shared<GlyphAtlas>(ivec2(4, 6), sheet.data()));
+  window.SetFont(GetTestFont());
+
+  window.Draw(Grid<AsciiCell, 2>(ivec2(5, 3), AsciiCell('A', 2, 1)));
+
+  EXPECT_EQ(window.GetFramebuffer().GetSize(), ivec2(20, 18));
+  EXPECT_EQ(window.GetFramebuffer()[ivec2(19, 17)], Color::Red);
+}
+
+TEST(SoftwareWindowTest, GlyphOnSecondPage_DrawPacked_DrawnFromThatPage) {
+  // Every glyph on the first page is empty and every glyph on the second is solid.
+  std::vector<unsigned char> sheet(2 * 2 * 256 * 2, 0);
+  std::fill(sheet.begin() + sheet.size() / 2, sheet.end(), 255);
+
+  SoftwareAsciiWindow window(std::make_shared<GlyphAtlas>(ivec2(2, 2), sheet.data(), 2));
+  window.SetFont(GetTestFont());
+
+  Grid<AsciiPackedCell, 2> grid(ivec2(2, 1), AsciiPackedCell('A', 2, 1));
+  grid[ivec2(1, 0)] = AsciiPackedCell(256 + 'A', 2, 1);
+
+  window.DrawPacked(grid);
+
+  EXPECT_EQ(window.GetFramebuffer()[ivec2(1, 1)], Color::White);
+  EXPECT_EQ(window.GetFramebuffer()[ivec2(3, 1)], Color::Red);
+}
+
+TEST(SoftwareWindowTest, PackedCopyOfGrid_DrawPacked_NothingRasterized) {
+  SoftwareAsciiWindow window;
+
+  Grid<AsciiCell, 2> grid(ivec2(4, 3), AsciiCell('a', 1, 0));
+  grid[ivec2(2, 1)] = AsciiCell('b', TransparentColor, 2);
+
+  Grid<AsciiPackedCell, 2> packed;
+  PackCells(grid, packed);
+
+  window.Draw(grid);
+  window.DrawPacked(packed);
+
+  EXPECT_EQ(window.GetRasterizedCells(), 0);
+}
+
+TEST(SoftwareWindowTest, GlyphDrawn_GetFramebuffer_PixelsMatchGlyphSheet) {
+  SoftwareAsciiWindow window;
+  window.SetFont(GetTestFont());
+
+  Grid<AsciiCell, 2> grid(ivec2(2, 1), AsciiCell(' ', 1, 0));
+  grid[ivec2(1, 0)] = AsciiCell('A', 2, 1);
+
+  window.Draw(grid);
+
+  Grid<Color, 2> const & framebuffer = window.GetFramebuffer();
+  ivec2 const            glyphSize   = GetGlyphSize();
+
+  for (ivec2 i; i != glyphSize; i = Grid<Color, 2>::GetNextCoord(i, glyphSize)) {
+    Color const expected = IsGlyphPixelSet('A', i) ? Color::Red : Color::White;
+
+    EXPECT_EQ(framebuffer[i + ivec2(glyphSize.x, 0)], expected);
+    EXPECT_EQ(framebuffer[i], Color::Black);
+  }
+}
+
+TEST(SoftwareWindowTest, SameGridDrawnTwice_Draw_NothingRasterizedSecondTime) {
+  SoftwareAsciiWindow window;
+  Grid<AsciiCell, 2>  grid(ivec2(10, 10), AsciiCell('x', 1, 0));
+
+  window.Draw(grid);
+  EXPECT_EQ(window.GetRasterizedCells(), 100);
+
+  window.Draw(grid);
+  EXPECT_EQ(window.GetRasterizedCells(), 0);
+
+  grid[ivec2(4, 4)].character = 'y';
+  window.Draw(grid);
+  EXPECT_EQ(window.GetRasterizedCells(), 1);
+}
+
+TEST(SoftwareWindowTest, FontChanged_Draw_AllCellsRasterizedWithNewColors) {
+  SoftwareAsciiWindow window;
+  Grid<AsciiCell, 2>  grid(ivec2(4, 4), AsciiCell(' ', 0, 1));
+
+  window.Draw(grid);
+
+  AsciiFont font = GetTestFont();
+  font.colors[1] = Color::Blue;
+  window.SetFont(font);
+  window.Draw(grid);
+
+  EXPECT_EQ(window.GetRasterizedCells(), 16);
+  EXPECT_EQ(window.GetFramebuffer()[ivec2(0, 0)], Color::Blue);
+}
+
+TEST(SoftwareWindowTest, HudLayerChanged_DrawLayers_OnlyHudCellsRasterized) {
+  SoftwareAsciiWindow      window;
+  Grid<AsciiCell, 2> const map(ivec2(20, 10), AsciiCell('.', 1, 0));
+  Grid<AsciiCell, 2>       hud(ivec2(3, 1), AsciiCell('1', 2, TransparentColor));
+  AsciiLayer const         layers[] = { AsciiLayer(map), AsciiLayer(hud, ivec2(5, 5)) };
+
+  window.DrawLayers(ivec2(20, 10), layers);
+  EXPECT_EQ(window.GetRasterizedCells(), 200);
+
+  hud[ivec2(1, 0)].character = '2';
+  window.DrawLayers(ivec2(20, 10), layers);
+
+  EXPECT_EQ(window.GetRasterizedCells(), 1);
+  EXPECT_EQ(window.GetFramebuffer().GetSize(), ivec2(20, 10) * GetGlyphSize());
+}
+
+TEST(SoftwareWindowTest, TransparentCell_DrawAndDrawLayers_BothShowColorZero) {
+  AsciiFont font = GetTestFont();
+  font.colors[PaletteColorCount - 1] = Color::Green;
+
+  Grid<AsciiCell, 2> const grid(ivec2(2, 2), AsciiCell(' ', TransparentColor, TransparentColor));
+  AsciiLayer const         layer(grid);
+
+  SoftwareAsciiWindow drawn;
+  drawn.SetFont(font);
+  drawn.Draw(grid);
+
+  SoftwareAsciiWindow layered;
+  layered.SetFont(font);
+  layered.DrawLayers(ivec2(2, 2), std::span<AsciiLayer const>(&layer, 1));
+
+  EXPECT_EQ(drawn.GetFramebuffer()[ivec2(0, 0)], Color::Black);
+  EXPECT_TRUE(std::equal(drawn.GetFramebuffer().begin(), drawn.GetFramebuffer().end(), layered.GetFramebuffer().begin()));
+}
+
+TEST(SoftwareWindowTest, DefaultConstructed_Sleep_RunMsAdvancesExactly) {
+  SoftwareAsciiWindow window;
+
+  EXPECT_EQ(window.GetRunMs(), 0);
+
+  window.Sleep(16);
+  window.Sleep(17);
+
+  EXPECT_EQ(window.GetRunMs(), 33);
+
+  window.SetRunMs(1000);
+
+  EXPECT_EQ(window.GetRunMs(), 1000);
+}
+
+TEST(SoftwareWindowTest, InputQueued_PollInput_InputReturnedOnce) {
+  SoftwareAsciiWindow window;
+
+  AsciiInputEvent event;
+  event.type               = AsciiInputType::Button;
+  event.buttonEvent.button = AsciiButton::A;
+  event.buttonEvent.isDown = true;
+
+  window.QueueInput(event);
+
+  std::vector<AsciiInputEvent> const first  = window.PollInput();
+  std::vector<AsciiInputEvent> const second = window.PollInput();
+
+  ASSERT_EQ(first.size(), 1);
+  EXPECT_EQ(first[0].buttonEvent.button, AsciiButton::A);
+  EXPECT_TRUE(second.empty());
+}
+
+TEST(SoftwareWindowTest, InputQueuedAfterDrain_DrainInput_OnlyNewInputReturned) {
+  SoftwareAsciiWindow window;
+
+  AsciiInputEvent first;
+  first.type             = AsciiInputType::MouseScroll;
+  first.mouseScrollEvent = 1;
+
+  AsciiInputEvent second;
+  second.type             = AsciiInputType::MouseScroll;
+  second.mouseScrollEvent = 2;
+
+  window.QueueInput(first);
+  window.DrainInput();
+  window.QueueInput(second);
+
+  std::span<AsciiInputEvent const> const events = window.DrainInput();
+
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events[0].mouseScrollEvent, 2);
+}
+
+TEST(SoftwareWindowTest, Resized_DrainInput_ResizeEventAndBackbufferOfNewSize) {
+  SoftwareAsciiWindow window;
+
+  window.Resize(ivec2(30, 20));
+
+  std::span<AsciiInputEvent const> const events = window.DrainInput();
+
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events[0].type, AsciiInputType::Resize);
+  EXPECT_EQ(events[0].resizeEvent, ivec2(30, 20));
+  EXPECT_EQ(window.AcquireBackbuffer().GetSize(), ivec2(30, 20));
+}
+
+TEST(SoftwareWindowTest, BackbufferDrawn_AcquireBackbuffer_SameGridKept) {
+  SoftwareAsciiWindow window;
+  window.Resize(ivec2(4, 3));
+
+  Grid<AsciiCell, 2> & backbuffer = window.AcquireBackbuffer();
+  AsciiCell const *    cells      = backbuffer.Data();
+
+  backbuffer[ivec2(1, 1)] = AsciiCell('A', 1, 0);
+  window.Draw(backbuffer);
+
+  EXPECT_EQ(window.AcquireBackbuffer().Data(), cells);
+  EXPECT_EQ(window.AcquireBackbuffer()[ivec2(1, 1)], AsciiCell('A', 1, 0));
+}
+
+TEST(SoftwareWindowTest, DeadlineInFuture_SleepUntilNs_ClockIsAtDeadline) {
+  SoftwareAsciiWindow window;
+
+  window.SetRunMs(10);
+  window.SleepUntilNs(12500000);
+
+  EXPECT_EQ(window.GetRunNs(), 12500000);
+  EXPECT_EQ(window.GetRunUs(), 12500);
+  EXPECT_EQ(window.GetRunMs(), 12);
+}
+
+TEST(SoftwareWindowTest, DeadlineInPast_SleepUntilNs_ClockDoesNotMove) {
+  SoftwareAsciiWindow window;
+
+  window.SetRunMs(10);
+  window.SleepUntilNs(5000000);
+
+  EXPECT_EQ(window.GetRunMs(), 10);
+}
+
+TEST(SoftwareWindowTest, PaletteCycling_Draw_OnlyCyclingCellsRasterized) {
+  SoftwareAsciiWindow window;
+  Grid<AsciiCell, 2>  grid(ivec2(4, 4), AsciiCell(' ', 0, 1));
+  grid[ivec2(2, 2)] = AsciiCell(' ', 0, GetBankColor(1, 0));
+
+  AsciiFont font = GetTestFont();
+  font.colors[GetBankColor(1, 0)] = Color::Green;
+  font.colors[GetBankColor(1, 1)] = Color::Blue;
+  font.cycles[0]                  = PaletteCycle{ GetBankColor(1, 0), 2, 100, false };
+  window.SetFont(font);
+  window.Draw(grid);
+
+  window.Sleep(100);
+  window.Draw(grid);
+
+  EXPECT_EQ(window.GetRasterizedCells(), 1);
+  EXPECT_EQ(window.GetFramebuffer()[ivec2(2, 2) * GetGlyphSize()], Color::Blue);
+}
+
+TEST(SoftwareWindowTest, CyclingCellChanged_Draw_RasterizedOnce) {
+  SoftwareAsciiWindow window;
+  Grid<AsciiCell, 2>  grid(ivec2(4, 4), AsciiCell(' ', 0, 1));
+  grid[ivec2(2, 2)] = AsciiCell(' ', 0, GetBankColor(1, 0));
+
+  AsciiFont font = GetTestFont();
+  font.colors[GetBankColor(1, 0)] = Color::Green;
+  font.colors[GetBankColor(1, 1)] = Color::Blue;
+  font.cycles[0]                  = PaletteCycle{ GetBankColor(1, 0), 2, 100, false };
+  window.SetFont(font);
+  window.Draw(grid);
+
+  grid[ivec2(2, 2)].character = 'x';
+  window.Sleep(100);
+  window.Draw(grid);
+
+  EXPECT_EQ(window.GetRasterizedCells(), 1);
+}
+
+TEST(SoftwareWindowTest, InputAndDraws_GetFrameStats_EventsAndCellsPerFrame) {
+  SoftwareAsciiWindow window;
+  Grid<AsciiCell, 2>  grid(ivec2(10, 10), AsciiCell('x', 1, 0));
+
+  window.QueueInput(AsciiInputEvent());
+  window.QueueInput(AsciiInputEvent());
+  window.DrainInput();
+  window.Draw(grid);
+
+  grid[ivec2(4, 4)].character = 'y';
+  window.DrainInput();
+  window.Draw(grid);
+
+  FrameStatsRecorder const & stats = window.GetFrameStats();
+
+  ASSERT_EQ(stats.GetFrameCount(), 2);
+  EXPECT_EQ(stats.GetFrame(1).inputEvents, 2);
+  EXPECT_EQ(stats.GetFrame(1).uploadedCells, 100);
+  EXPECT_EQ(stats.GetFrame(0).inputEvents, 0);
+  EXPECT_EQ(stats.GetFrame(0).uploadedCells, 1);
+}
+
+TEST(SoftwareWindowTest, EveryDrawCall_GetFrameStats_OneFrameEach) {
+  SoftwareAsciiWindow            window;
+  Grid<AsciiCell, 2> const       grid(ivec2(4, 4), AsciiCell('x', 1, 0));
+  Grid<AsciiPackedCell, 2> const packed(ivec2(4, 4), AsciiPackedCell('y', 1, 0));
+  AsciiLayer const               layer(grid);
+
+  window.Draw(grid);
+  window.DrawPacked(packed);
+  window.DrawLayers(ivec2(4, 4), std::span<AsciiLayer const>(&layer, 1));
+
+  FrameStatsRecorder const & stats = window.GetFrameStats();
+
+  ASSERT_EQ(stats.GetFrameCount(), 3);
+  for (int age = 0; age < 3; ++age) {
+    EXPECT_EQ(stats.GetFrame(age).uploadedCells, 16);
+  }
+}
+
+TEST(SoftwareWindowTest, SleepBetweenDraws_GetFrameStats_FrameTimesOnVirtualClock) {
+  SoftwareAsciiWindow      window;
+  Grid<AsciiCell, 2> const grid(ivec2(4, 4), AsciiCell('x', 1, 0));
+
+  window.Draw(grid);
+  window.Sleep(16);
+  window.Draw(grid);
+
+  FrameStatsRecorder const & stats = window.GetFrameStats();
+
+  EXPECT_EQ(stats.GetFrame(0).frameNs, 16000000);
+  EXPECT_EQ(stats.GetFrame(0).drawNs, 0);
+  EXPECT_EQ(stats.GetTimes(AsciiFrameTime::Frame).GetMaxNs(), 16000000);
+}
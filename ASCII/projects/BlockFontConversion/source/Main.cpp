@@ -2,97 +2,135 @@
  * Copywrite 2022 Dodge Lafnitzegger
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
+#include "Window/GlyphAtlas.h"
+
 namespace {
-  bool GetInfoFromArgs(
-    int                  argc,
-    char const * const * argv,
-    int &                o_glyphSize,
-    std::string &        o_inputFilename,
-    std::string &        o_outputFilename
-  ) {
-    o_glyphSize = 0;
-
-    if (argc == 4) {
-      o_glyphSize      = std::atoi(argv[1]);
-      o_inputFilename  = argv[2];
-      o_outputFilename = argv[3];
-    }
-    else if (argc == 3) {
-      o_glyphSize     = std::atoi(argv[1]);
-      o_inputFilename = argv[2];
-
-      int const fileTypeIndex = o_inputFilename.find_last_of('.');
-
-      if (fileTypeIndex > 0) {
-        o_outputFilename = o_inputFilename.substr(0, fileTypeIndex);
-      }
-      else {
-        o_outputFilename = o_inputFilename;
-      }
-      o_outputFilename += ".cpp";
+  struct ConversionJob {
+    int         glyphSize = 0;
+    std::string inputFilename;
+    std::string outputFilename;
+    std::string errors;
+    bool        isConverted = false;
+  };
+
+  std::string GetDefaultOutputFilename(std::string const & inputFilename) {
+    int const fileTypeIndex = inputFilename.find_last_of('.');
+
+    if (fileTypeIndex > 0) {
+      return inputFilename.substr(0, fileTypeIndex) + ".cpp";
     }
-    else {
-      std::string programName        = argv[0];
-      int const   fileSeparatorIndex = std::max<int>(programName.find_last_of('\\'), programName.find_last_of('/'));
 
-      if (fileSeparatorIndex != -1) {
-        programName = programName.substr(fileSeparatorIndex + 1);
+    return inputFilename + ".cpp";
+  }
+
+  void PrintUsage(char const * argv0) {
+    std::string programName        = argv0;
+    int const   fileSeparatorIndex = std::max<int>(programName.find_last_of('\\'), programName.find_last_of('/'));
+
+    if (fileSeparatorIndex != -1) {
+      programName = programName.substr(fileSeparatorIndex + 1);
+    }
+
+    std::cerr <<
+      "Usage:" << std::endl <<
+      "  " << programName << " <glyph_size> <input_file> [<output_file>]" << std::endl <<
+      "  " << programName << " --batch <glyph_size> <input_file> [<glyph_size> <input_file> ...]" << std::endl <<
+      std::endl <<
+      "  glyph_size:             The edge length of the square glyphs in the image." << std::endl <<
+      "  input_file:             The file to read the image from." << std::endl <<
+      "  output_file (optional): The file to store the block font definitions in. If blank," << std::endl <<
+      "                          this will be the same as input_file but with a .cpp extension." << std::endl <<
+      std::endl <<
+      "  A glyph atlas that can be loaded at run time is also written next to output_file with an" << std::endl <<
+      "  .atlas extension." << std::endl <<
+      std::endl <<
+      "  --batch converts every pair of glyph size and image in parallel. Outputs are always named" << std::endl <<
+      "  after the input file." << std::endl
+    ;
+  }
+
+  bool GetJobsFromArgs(int argc, char const * const * argv, std::vector<ConversionJob> & o_jobs) {
+    o_jobs.clear();
+
+    if (argc >= 2 && std::strcmp(argv[1], "--batch") == 0) {
+      if (argc < 4 || (argc - 2) % 2 != 0) {
+        PrintUsage(argv[0]);
+
+        return false;
       }
 
-      std::cerr <<
-        "Usage:" << std::endl <<
-        "  " << programName << " <glyph_size> <input_file> [<output_file>]" << std::endl <<
-        std::endl <<
-        "  glyph_size:             The edge length of the square glyphs in the image." << std::endl <<
-        "  input_file:             The file to read the image from." << std::endl <<
-        "  output_file (optional): The file to store the block font definitions in. If blank," << std::endl <<
-        "                          this will be the same as input_file but with a .cpp extension." << std::endl
-      ;
+      for (int i = 2; i < argc; i += 2) {
+        ConversionJob & job = o_jobs.emplace_back();
 
-      return false;
+        job.glyphSize      = std::atoi(argv[i]);
+        job.inputFilename  = argv[i + 1];
+        job.outputFilename = GetDefaultOutputFilename(job.inputFilename);
+      }
     }
+    else if (argc == 3 || argc == 4) {
+      ConversionJob & job = o_jobs.emplace_back();
 
-    if (o_glyphSize < 1) {
-      std::cerr << "Glyph size must be greater than 0." << std::endl;
+      job.glyphSize      = std::atoi(argv[1]);
+      job.inputFilename  = argv[2];
+      job.outputFilename = argc == 4 ? std::string(argv[3]) : GetDefaultOutputFilename(job.inputFilename);
+    }
+    else {
+      PrintUsage(argv[0]);
 
       return false;
     }
 
+    for (ConversionJob const & job : o_jobs) {
+      if (job.glyphSize < 1) {
+        std::cerr << "Glyph size must be greater than 0." << std::endl;
+
+        return false;
+      }
+    }
+
     return true;
   }
 
   std::string ConvertImageToString(stbi_uc const * image, int glyphSize) {
+    size_t const               glyphArea = size_t(glyphSize) * glyphSize;
     std::vector<unsigned char> glyphs[256];
 
     for (std::vector<unsigned char> & glyph : glyphs) {
-      glyph.reserve(size_t(glyphSize) * glyphSize);
+      glyph.resize(glyphArea);
     }
 
+    // Whole glyph rows are contiguous in the image, so they're copied a row at a time.
     for (int i = 0; i < glyphSize * 16; ++i) {
-      for (int j = 0; j < glyphSize * 16; ++j) {
-        int const glyphXPos = j / glyphSize;
-        int const glyphYPos = i / glyphSize;
+      stbi_uc const * const imageRow = image + size_t(i) * glyphSize * 16;
 
-        int const index = glyphYPos * 16 + glyphXPos;
-        int const imageIndex = i * glyphSize * 16 + j;
+      for (int glyphXPos = 0; glyphXPos < 16; ++glyphXPos) {
+        int const index = (i / glyphSize) * 16 + glyphXPos;
 
-        glyphs[index].emplace_back(image[imageIndex]);
+        std::memcpy(glyphs[index].data() + size_t(i % glyphSize) * glyphSize, imageRow + glyphXPos * glyphSize, size_t(glyphSize));
       }
     }
 
     std::string result;
 
-    result += 
+    // Each value takes up to five characters and empty glyphs far fewer, so this is rarely exceeded.
+    result.reserve(size_t(glyphSize) * glyphSize * 256 * 5 + 256 * 32);
+
+    result +=
       "// Generated to contain glyph data.\n"
-      "static unsigned char const s_glyphs[256][144] = {\n"
+      "static unsigned char const s_glyphs[256][" + std::to_string(glyphSize * glyphSize) + "] = {\n"
     ;
 
     int glyphindex        = 0;
@@ -153,24 +191,63 @@ namespace {
     return result;
   }
 
-  bool ConvertFileToCpp(int glyphSize, std::string const & inputFilename, std::string const & outputFilename) {
+  std::string GetAtlasFilename(std::string const & outputFilename) {
+    size_t const fileTypeIndex      = outputFilename.find_last_of('.');
+    size_t const fileSeparatorIndex = outputFilename.find_last_of("\\/");
+
+    if (fileTypeIndex != std::string::npos && (fileSeparatorIndex == std::string::npos || fileTypeIndex > fileSeparatorIndex)) {
+      return outputFilename.substr(0, fileTypeIndex) + ".atlas";
+    }
+
+    return outputFilename + ".atlas";
+  }
+
+  void ThresholdSheet(stbi_uc const * image, size_t size, unsigned char * o_sheet) {
+    // Branchless so it vectorizes, the same cut off the compiled in font gets.
+    for (size_t i = 0; i < size; ++i) {
+      o_sheet[i] = (unsigned char)(0 - (unsigned char)(image[i] != 0));
+    }
+  }
+
+  bool WriteAtlasFile(stbi_uc const * image, int glyphSize, std::string const & atlasFilename, std::ostream & o_errors) {
+    // The image is already laid out as a glyph sheet.
+    std::vector<unsigned char> sheet(size_t(glyphSize) * 16 * glyphSize * 16);
+    ThresholdSheet(image, sheet.size(), sheet.data());
+
+    std::vector<unsigned char> bytes;
+    WriteGlyphAtlas(ivec2(glyphSize, glyphSize), sheet.data(), bytes);
+
+    std::ofstream atlasFile(atlasFilename, std::ios::binary);
+    atlasFile.write(reinterpret_cast<char const *>(bytes.data()), std::streamsize(bytes.size()));
+
+    if (!atlasFile) {
+      o_errors << "Couldn't write glyph atlas '" << atlasFilename << "'." << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  bool ConvertFile(int glyphSize, std::string const & inputFilename, std::string const & outputFilename, std::ostream & o_errors) {
     int width;
     int height;
     int components;
-    stbi_uc const * const image = stbi_load(inputFilename.c_str(), &width, &height, &components, 1);
+    stbi_uc * const image = stbi_load(inputFilename.c_str(), &width, &height, &components, 1);
 
     if (image == nullptr) {
-      std::cerr << "Didn't read image. stbi error: " << stbi_failure_reason() << std::endl;
+      o_errors << "Didn't read image '" << inputFilename << "'. stbi error: " << stbi_failure_reason() << std::endl;
       return false;
     }
 
     int const expectedSize = glyphSize * 16;
 
     if (width != expectedSize || height != expectedSize) {
-      std::cerr <<
+      o_errors <<
         "Size of '" << inputFilename << "' not correct for glyph size " << glyphSize << "." << std::endl <<
         "Width and height expected to be " << expectedSize << " pixels." << std::endl;
 
+      stbi_image_free(image);
+
       return false;
     }
 
@@ -179,22 +256,61 @@ namespace {
     std::ofstream outputFile(outputFilename);
     outputFile << fileOutput;
 
-    return true;
+    bool isWritten = true;
+    if (!outputFile) {
+      o_errors << "Couldn't write block font '" << outputFilename << "'." << std::endl;
+      isWritten = false;
+    }
+
+    isWritten = WriteAtlasFile(image, glyphSize, GetAtlasFilename(outputFilename), o_errors) && isWritten;
+
+    stbi_image_free(image);
+
+    return isWritten;
+  }
+
+  void ConvertJobs(std::vector<ConversionJob> & io_jobs) {
+    std::atomic<size_t> nextJob     = 0;
+    int const           threadCount = (int)std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), io_jobs.size());
+
+    auto const work = [&](void) {
+      for (size_t i = nextJob++; i < io_jobs.size(); i = nextJob++) {
+        ConversionJob &    job = io_jobs[i];
+        std::ostringstream errors;
+
+        job.isConverted = ConvertFile(job.glyphSize, job.inputFilename, job.outputFilename, errors);
+        job.errors      = errors.str();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; ++i) {
+      threads.emplace_back(work);
+    }
+
+    work();
+
+    for (std::thread & thread : threads) {
+      thread.join();
+    }
   }
 }
 
 int main(int argc, char const * const * argv) {
-  std::string inputFilename;
-  std::string outputFilename;
-  int         glyphSize;
-  
-  if (!GetInfoFromArgs(argc, argv, glyphSize, inputFilename, outputFilename)) {
+  std::vector<ConversionJob> jobs;
+
+  if (!GetJobsFromArgs(argc, argv, jobs)) {
     return 1;
   }
 
-  if (!ConvertFileToCpp(glyphSize, inputFilename, outputFilename)) {
-    return 1;
+  ConvertJobs(jobs);
+
+  // Errors are reported in argument order rather than as threads finish.
+  bool isConverted = true;
+  for (ConversionJob const & job : jobs) {
+    std::cerr << job.errors;
+    isConverted = isConverted && job.isConverted;
   }
 
-  return 0;
+  return isConverted ? 0 : 1;
 }
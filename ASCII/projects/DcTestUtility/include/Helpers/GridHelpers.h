@@ -0,0 +1,21 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCTESTUTILITY_HELPERS_GRIDHELPERS_H
+#define DCTESTUTILITY_HELPERS_GRIDHELPERS_H
+
+#include "Containers/Grid.h"
+
+// Each cell holds its row-major index.
+inline Grid<int, 2> MakeNumberedGrid(ivec2 const & size) {
+  Grid<int, 2> result(size);
+
+  for (int i = 0; i < result.Count(); ++i) {
+    result.Data()[i] = i;
+  }
+
+  return result;
+}
+
+#endif // DCTESTUTILITY_HELPERS_GRIDHELPERS_H
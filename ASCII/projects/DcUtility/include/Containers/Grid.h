@@ -5,11 +5,18 @@
 #ifndef DCUTILITY_CONTAINERS_GRID_H
 #define DCUTILITY_CONTAINERS_GRID_H
 
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "Containers/GridLayout.h"
+#include "Containers/GridRange.h"
 #include "Math/Vector.h"
 
-template <typename T, int Dimensions>
+// Layout picks how cells are ordered in storage. See GridLayout.h.
+template <typename T, int Dimensions, typename Layout = RowMajorGridLayout>
 class Grid {
 public:
   static ivec<Dimensions> GetNextCoord(
@@ -51,15 +58,34 @@ public:
   Grid & operator =(Grid &&) = default;
 
   T const & operator [](ivec<Dimensions> const & location) const {
-    int const index = location.Dot(m_indexer);
+    int const index = m_indexer.GetIndex(location);
     return m_data[index];
   }
 
   T & operator [](ivec<Dimensions> const & location) {
-    int const index = location.Dot(m_indexer);
+    int const index = m_indexer.GetIndex(location);
     return m_data[index];
   }
 
+  // Every cell with its location, in row-major order. See GridRange.h.
+  GridCellRange<T const, Dimensions> GetCells(void) const requires (std::is_same_v<Layout, RowMajorGridLayout>) {
+    return GridCellRange<T const, Dimensions>(m_data.data(), m_size, GetRowMajorStrides(m_size));
+  }
+
+  GridCellRange<T, Dimensions> GetCells(void) requires (std::is_same_v<Layout, RowMajorGridLayout>) {
+    return GridCellRange<T, Dimensions>(m_data.data(), m_size, GetRowMajorStrides(m_size));
+  }
+
+  // Every row as a span, with the location of its first cell.
+  GridRowRange<T const, Dimensions> GetRows(void) const requires (std::is_same_v<Layout, RowMajorGridLayout>) {
+    return GridRowRange<T const, Dimensions>(m_data.data(), m_size, GetRowMajorStrides(m_size));
+  }
+
+  GridRowRange<T, Dimensions> GetRows(void) requires (std::is_same_v<Layout, RowMajorGridLayout>) {
+    return GridRowRange<T, Dimensions>(m_data.data(), m_size, GetRowMajorStrides(m_size));
+  }
+
+  // Count() cells in storage order, which is only row-major for RowMajorGridLayout.
   T const * Data(void) const {
     return m_data.data();
   }
@@ -76,18 +102,34 @@ public:
     return m_size;
   }
 
+  // Cells inside both the old and new size keep their values and the rest are reset to T(). The
+  // storage is reused when it's big enough.
   void SetSize(ivec<Dimensions> const & size) {
-    ivec<Dimensions> const minBounds = m_size.Min(size);
+    if constexpr (std::is_same_v<Layout, RowMajorGridLayout>) {
+      SetRowMajorSize(size);
+    }
+    else {
+      ivec<Dimensions> const minBounds = m_size.Min(size);
 
-    Grid newGrid(size);
-    for (ivec<Dimensions> i; i != minBounds; i = GetNextCoord(i, minBounds)) {
-      newGrid[i] = (*this)[i];
+      Grid newGrid(size);
+      for (ivec<Dimensions> i; i != minBounds; i = GetNextCoord(i, minBounds)) {
+        newGrid[i] = std::move((*this)[i]);
+      }
+      *this = std::move(newGrid);
     }
-    *this = std::move(newGrid);
 
     EvaluateIndexer();
   }
 
+  // Makes room for count cells, so that SetSize won't allocate until the grid grows past it.
+  void Reserve(int count) {
+    m_data.reserve(count);
+  }
+
+  int GetCapacity(void) const {
+    return int(m_data.capacity());
+  }
+
   bool Empty(void) const {
     for (int i = 0; i < Dimensions; ++i) {
       if (m_size[i] != 0) {
@@ -118,16 +160,130 @@ public:
   }
 
 private:
-  void EvaluateIndexer(void) {
-    m_indexer[0] = 1;
+  using Indexer = typename Layout::template Indexer<Dimensions>;
+
+  static ivec<Dimensions> GetRowMajorStrides(ivec<Dimensions> const & size) {
+    ivec<Dimensions> result;
+
+    result[0] = 1;
     for (int i = 1; i < Dimensions; ++i) {
-      m_indexer[i] = m_size[i - 1] * m_indexer[i - 1];
+      result[i] = size[i - 1] * result[i - 1];
+    }
+
+    return result;
+  }
+
+  static void MoveCells(T * source, T * destination, int count) {
+    if (source == destination || count == 0) {
+      return;
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memmove(destination, source, count * sizeof(T));
+    }
+    else if (destination < source) {
+      std::move(source, source + count, destination);
     }
+    else {
+      std::move_backward(source, source + count, destination + count);
+    }
+  }
+
+  static void ResetCells(T * begin, T * end) {
+    std::fill(begin, end, T());
+  }
+
+  // Moves each kept row, the first dimension being contiguous, straight to its new place. When no
+  // stride shrinks every row moves to a later index, so going from the last row to the first never
+  // overwrites a row that hasn't moved yet. When none grows the reverse holds. If some strides grow
+  // and others shrink there's no safe order, so the rows go to fresh storage instead.
+  void SetRowMajorSize(ivec<Dimensions> const & size) {
+    ivec<Dimensions> const minBounds  = m_size.Min(size);
+    ivec<Dimensions> const oldStrides = GetRowMajorStrides(m_size);
+    ivec<Dimensions> const newStrides = GetRowMajorStrides(size);
+    int const              newCount   = size.Product();
+    int const              rowLength  = minBounds[0];
+
+    bool isGrowing   = true;
+    bool isShrinking = true;
+    for (int i = 1; i < Dimensions; ++i) {
+      isGrowing   &= newStrides[i] >= oldStrides[i];
+      isShrinking &= newStrides[i] <= oldStrides[i];
+    }
+
+    // The first location of each kept row, in row-major order.
+    ivec<Dimensions> rowsSize;
+    if (minBounds.Product() != 0) {
+      rowsSize    = minBounds;
+      rowsSize[0] = 1;
+    }
+
+    if (!isGrowing && !isShrinking) {
+      std::vector<T> newData(newCount);
+
+      for (ivec<Dimensions> i; i != rowsSize; i = GetNextCoord(i, rowsSize)) {
+        T * const source = m_data.data() + i.Dot(oldStrides);
+        std::move(source, source + rowLength, newData.data() + i.Dot(newStrides));
+      }
+
+      m_data = std::move(newData);
+      m_size = size;
+      return;
+    }
+
+    if (newCount > int(m_data.size())) {
+      m_data.resize(newCount);
+    }
+
+    T * const data = m_data.data();
+
+    if (isShrinking) {
+      for (ivec<Dimensions> i; i != rowsSize; i = GetNextCoord(i, rowsSize)) {
+        MoveCells(data + i.Dot(oldStrides), data + i.Dot(newStrides), rowLength);
+      }
+    }
+    else {
+      int const rowCount = rowsSize.Product();
+
+      for (int row = rowCount - 1; row >= 0; --row) {
+        ivec<Dimensions> const i = GetRowLocation(row, rowsSize);
+        MoveCells(data + i.Dot(oldStrides), data + i.Dot(newStrides), rowLength);
+      }
+    }
+
+    // Whatever lies between the moved rows is either new or left over from before.
+    int keptEnd = 0;
+    for (ivec<Dimensions> i; i != rowsSize; i = GetNextCoord(i, rowsSize)) {
+      int const rowStart = i.Dot(newStrides);
+
+      ResetCells(data + keptEnd, data + rowStart);
+      keptEnd = rowStart + rowLength;
+    }
+    ResetCells(data + keptEnd, data + newCount);
+
+    m_data.resize(newCount);
+    m_size = size;
+  }
+
+  // The location of the index-th row start in a grid of rowsSize, whose first dimension is 1.
+  static ivec<Dimensions> GetRowLocation(int index, ivec<Dimensions> const & rowsSize) {
+    ivec<Dimensions> result;
+
+    for (int i = 1; i < Dimensions; ++i) {
+      result[i] = index % rowsSize[i];
+      index    /= rowsSize[i];
+    }
+
+    return result;
+  }
+
+  void EvaluateIndexer(void) {
+    m_indexer = Indexer(m_size);
   }
 
   std::vector<T>   m_data;
   ivec<Dimensions> m_size;
-  ivec<Dimensions> m_indexer;
+  Indexer          m_indexer;
 };
 
 #endif // DCUTILITY_CONTAINERS_GRID_H
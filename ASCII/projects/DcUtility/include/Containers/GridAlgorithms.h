@@ -0,0 +1,373 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCUTILITY_CONTAINERS_GRIDALGORITHMS_H
+#define DCUTILITY_CONTAINERS_GRIDALGORITHMS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Containers/GridView.h"
+
+// Whole-grid algorithms over a row-major Grid or a GridView of one. Each works a row at a time on
+// plain spans, so loops over trivially copyable cells can vectorize, and copies and compares
+// between grids of the same cell type use memcpy and memcmp. Grids given together have to be the
+// same size.
+//
+// Big grids can be split across threads by rows. Functions given to the algorithms are then called
+// from several threads at once, in no particular order.
+
+struct GridParallelism {
+  // Threads to use, counting the calling one. std::thread::hardware_concurrency() is the most that
+  // helps.
+  int threadCount = 1;
+
+  // Grids with fewer cells than this stay on the calling thread, since starting threads costs more
+  // than the work does.
+  int minParallelCells = 1 << 16;
+};
+
+// How ForEachGridRowBlock splits the rows of a grid. Empty grids have no blocks.
+struct GridRowBlocks {
+  int rowCount    = 0;
+  int threadCount = 1;
+  int blockRows   = 0;
+  int blockCount  = 0;
+};
+
+template <int Dimensions>
+GridRowBlocks GetGridRowBlocks(ivec<Dimensions> const & size, GridParallelism const & parallelism) {
+  int const     cellCount = size.Product();
+  GridRowBlocks result;
+
+  if (cellCount == 0) {
+    return result;
+  }
+
+  int const blocksPerThread = 4;
+
+  result.rowCount    = cellCount / size[0];
+  result.threadCount = cellCount < parallelism.minParallelCells ? 1 : std::clamp(parallelism.threadCount, 1, result.rowCount);
+  result.blockRows   = result.threadCount == 1 ? result.rowCount : std::max(1, result.rowCount / (result.threadCount * blocksPerThread));
+  result.blockCount  = (result.rowCount + result.blockRows - 1) / result.blockRows;
+
+  return result;
+}
+
+// Calls function(beginRow, endRow, block) for blocks of the rows of a grid of size, counting rows
+// in row-major order. Blocks are handed out as threads finish earlier ones, so uneven rows don't
+// leave threads idle. Returns the number of blocks, which GetGridRowBlocks gives ahead of time.
+//
+// If function throws, no more blocks are started and the first exception is rethrown on the
+// calling thread once every thread has stopped.
+template <int Dimensions, typename Function>
+int ForEachGridRowBlock(ivec<Dimensions> const & size, GridParallelism const & parallelism, Function const & function) {
+  GridRowBlocks const blocks = GetGridRowBlocks(size, parallelism);
+
+  if (blocks.blockCount <= 1) {
+    if (blocks.blockCount == 1) {
+      function(0, blocks.rowCount, 0);
+    }
+
+    return blocks.blockCount;
+  }
+
+  int const          rowCount   = blocks.rowCount;
+  int const          blockRows  = blocks.blockRows;
+  int const          blockCount = blocks.blockCount;
+  std::atomic<int>   nextBlock  = 0;
+  std::exception_ptr exception;
+  std::mutex         exceptionMutex;
+
+  auto const work = [&](void) {
+    try {
+      for (int block = nextBlock++; block < blockCount; block = nextBlock++) {
+        function(block * blockRows, std::min(rowCount, (block + 1) * blockRows), block);
+      }
+    }
+    catch (...) {
+      std::lock_guard<std::mutex> const lock(exceptionMutex);
+
+      if (!exception) {
+        exception = std::current_exception();
+      }
+
+      nextBlock = blockCount;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < blocks.threadCount; ++i) {
+    threads.emplace_back(work);
+  }
+
+  work();
+
+  for (std::thread & thread : threads) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  return blockCount;
+}
+
+// The location of the first cell of row r of a grid of size.
+template <int Dimensions>
+ivec<Dimensions> GetGridRowLocation(int row, ivec<Dimensions> const & size) {
+  ivec<Dimensions> result;
+
+  for (int i = 1; i < Dimensions; ++i) {
+    result[i] = row % size[i];
+    row      /= size[i];
+  }
+
+  return result;
+}
+
+template <typename T, int Dimensions>
+std::span<T> GetGridRow(GridView<T, Dimensions> const & view, int row) {
+  return std::span<T>(&view[GetGridRowLocation(row, view.GetSize())], view.GetSize()[0]);
+}
+
+template <typename GridType, typename T>
+void FillGrid(GridType && grid, T const & value, GridParallelism const & parallelism = GridParallelism()) {
+  GridView const view(grid);
+
+  ForEachGridRowBlock(view.GetSize(), parallelism, [&](int beginRow, int endRow, int) {
+    for (int row = beginRow; row < endRow; ++row) {
+      std::span const cells = GetGridRow(view, row);
+      std::fill(cells.begin(), cells.end(), value);
+    }
+  });
+}
+
+// Sets each cell of dest to function(cell of source). dest and source may be the same grid.
+template <typename SourceGridType, typename DestGridType, typename Function>
+void TransformGrid(
+  SourceGridType &&       source,
+  DestGridType &&         dest,
+  Function const &        function,
+  GridParallelism const & parallelism = GridParallelism()
+) {
+  GridView const sourceView(source);
+  GridView const destView(dest);
+
+  ForEachGridRowBlock(destView.GetSize(), parallelism, [&](int beginRow, int endRow, int) {
+    for (int row = beginRow; row < endRow; ++row) {
+      std::span const sourceCells = GetGridRow(sourceView, row);
+      std::span const destCells   = GetGridRow(destView, row);
+
+      for (size_t x = 0; x < destCells.size(); ++x) {
+        destCells[x] = function(sourceCells[x]);
+      }
+    }
+  });
+}
+
+// Sets each cell of grid to function(location, cell).
+template <typename GridType, typename Function>
+void TransformGridWithLocation(GridType && grid, Function const & function, GridParallelism const & parallelism = GridParallelism()) {
+  GridView const view(grid);
+
+  ForEachGridRowBlock(view.GetSize(), parallelism, [&](int beginRow, int endRow, int) {
+    for (int row = beginRow; row < endRow; ++row) {
+      auto            location = GetGridRowLocation(row, view.GetSize());
+      std::span const cells    = GetGridRow(view, row);
+
+      for (size_t x = 0; x < cells.size(); ++x) {
+        location[0] = int(x);
+        cells[x]    = function(location, cells[x]);
+      }
+    }
+  });
+}
+
+// Folds every cell into identity with op(result, cell). On several threads each block of rows is
+// folded from identity and the blocks are then folded together in order with op(result, result),
+// so op has to be associative and identity has to leave it unchanged, like 0 for a sum.
+template <typename GridType, typename Result, typename Function>
+Result ReduceGrid(GridType && grid, Result const & identity, Function const & op, GridParallelism const & parallelism = GridParallelism()) {
+  // Wrapped so that threads writing neighboring partials never share a std::vector<bool> word.
+  struct Partial {
+    Result value;
+  };
+
+  GridView const      view(grid);
+  GridRowBlocks const blocks = GetGridRowBlocks(view.GetSize(), parallelism);
+
+  auto const foldRows = [&](int beginRow, int endRow) {
+    Result partial = identity;
+
+    for (int row = beginRow; row < endRow; ++row) {
+      for (auto const & cell : GetGridRow(view, row)) {
+        partial = op(partial, cell);
+      }
+    }
+
+    return partial;
+  };
+
+  // A single block is the result, so there's nothing to allocate.
+  if (blocks.blockCount <= 1) {
+    return foldRows(0, blocks.rowCount);
+  }
+
+  std::vector<Partial> partials(blocks.blockCount, Partial { identity });
+
+  ForEachGridRowBlock(view.GetSize(), parallelism, [&](int beginRow, int endRow, int block) {
+    partials[block].value = foldRows(beginRow, endRow);
+  });
+
+  Result result = identity;
+  for (Partial const & partial : partials) {
+    result = op(result, partial.value);
+  }
+
+  return result;
+}
+
+template <typename GridType, typename Predicate>
+int CountGridCellsIf(GridType && grid, Predicate const & predicate, GridParallelism const & parallelism = GridParallelism()) {
+  GridView const   view(grid);
+  std::atomic<int> result = 0;
+
+  ForEachGridRowBlock(view.GetSize(), parallelism, [&](int beginRow, int endRow, int) {
+    int count = 0;
+
+    for (int row = beginRow; row < endRow; ++row) {
+      std::span const cells = GetGridRow(view, row);
+      count += int(std::count_if(cells.begin(), cells.end(), predicate));
+    }
+
+    result += count;
+  });
+
+  return result;
+}
+
+template <typename GridType, typename T>
+int CountGridCells(GridType && grid, T const & value, GridParallelism const & parallelism = GridParallelism()) {
+  return CountGridCellsIf(grid, [&](auto const & cell) { return cell == value; }, parallelism);
+}
+
+// Copies source into dest. Use views to copy between parts of grids, but they mustn't overlap.
+template <typename SourceGridType, typename DestGridType>
+void CopyGrid(SourceGridType && source, DestGridType && dest, GridParallelism const & parallelism = GridParallelism()) {
+  GridView const sourceView(source);
+  GridView const destView(dest);
+
+  ForEachGridRowBlock(destView.GetSize(), parallelism, [&](int beginRow, int endRow, int) {
+    for (int row = beginRow; row < endRow; ++row) {
+      std::span const sourceCells = GetGridRow(sourceView, row);
+      std::span const destCells   = GetGridRow(destView, row);
+
+      using SourceCell = std::remove_cv_t<typename decltype(sourceCells)::element_type>;
+      using DestCell   = typename decltype(destCells)::value_type;
+
+      // Cells of another type have to be converted one at a time.
+      if constexpr (std::is_same_v<SourceCell, DestCell> && std::is_trivially_copyable_v<DestCell>) {
+        std::memcpy(destCells.data(), sourceCells.data(), sourceCells.size_bytes());
+      }
+      else {
+        std::copy(sourceCells.begin(), sourceCells.end(), destCells.begin());
+      }
+    }
+  });
+}
+
+// Whether every cell of a equals the one at the same location in b.
+template <typename GridTypeA, typename GridTypeB>
+bool AreGridsEqual(GridTypeA && a, GridTypeB && b, GridParallelism const & parallelism = GridParallelism()) {
+  GridView const viewA(a);
+  GridView const viewB(b);
+
+  if (viewA.GetSize() != viewB.GetSize()) {
+    return false;
+  }
+
+  std::atomic<bool> result = true;
+
+  ForEachGridRowBlock(viewA.GetSize(), parallelism, [&](int beginRow, int endRow, int) {
+    for (int row = beginRow; row < endRow && result; ++row) {
+      std::span const cellsA = GetGridRow(viewA, row);
+      std::span const cellsB = GetGridRow(viewB, row);
+
+      using CellA = typename decltype(cellsA)::value_type;
+      using CellB = typename decltype(cellsB)::value_type;
+
+      // Different types, and types with padding or several representations of a value, have to use
+      // operator ==.
+      if constexpr (std::is_same_v<CellA, CellB> && std::has_unique_object_representations_v<CellA>) {
+        if (std::memcmp(cellsA.data(), cellsB.data(), cellsA.size_bytes()) != 0) {
+          result = false;
+        }
+      }
+      else if (!std::equal(cellsA.begin(), cellsA.end(), cellsB.begin())) {
+        result = false;
+      }
+    }
+  });
+
+  return result;
+}
+
+// Sets o_locations to every location where previous and current differ, in row-major order.
+template <typename GridTypeA, typename GridTypeB, int Dimensions>
+void FindGridDifferences(
+  GridTypeA &&                    previous,
+  GridTypeB &&                    current,
+  std::vector<ivec<Dimensions>> & o_locations,
+  GridParallelism const &         parallelism = GridParallelism()
+) {
+  GridView const      previousView(previous);
+  GridView const      currentView(current);
+  GridRowBlocks const blocks = GetGridRowBlocks(previousView.GetSize(), parallelism);
+
+  auto const findInRows = [&](int beginRow, int endRow, std::vector<ivec<Dimensions>> & io_locations) {
+    for (int row = beginRow; row < endRow; ++row) {
+      std::span const previousCells = GetGridRow(previousView, row);
+      std::span const currentCells  = GetGridRow(currentView, row);
+
+      for (size_t x = 0; x < previousCells.size(); ++x) {
+        if (!(previousCells[x] == currentCells[x])) {
+          ivec<Dimensions> location = GetGridRowLocation(row, previousView.GetSize());
+          location[0] = int(x);
+
+          io_locations.emplace_back(location);
+        }
+      }
+    }
+  };
+
+  o_locations.clear();
+
+  // A single block is already in order, so it goes straight into o_locations.
+  if (blocks.blockCount <= 1) {
+    findInRows(0, blocks.rowCount, o_locations);
+    return;
+  }
+
+  // Otherwise each block finds its own differences so they can be put back in order afterwards.
+  std::vector<std::vector<ivec<Dimensions>>> blockLocations(blocks.blockCount);
+
+  ForEachGridRowBlock(previousView.GetSize(), parallelism, [&](int beginRow, int endRow, int block) {
+    findInRows(beginRow, endRow, blockLocations[block]);
+  });
+
+  for (std::vector<ivec<Dimensions>> const & locations : blockLocations) {
+    o_locations.insert(o_locations.end(), locations.begin(), locations.end());
+  }
+}
+
+#endif // DCUTILITY_CONTAINERS_GRIDALGORITHMS_H
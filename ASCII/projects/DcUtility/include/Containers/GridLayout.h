@@ -0,0 +1,165 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCUTILITY_CONTAINERS_GRIDLAYOUT_H
+#define DCUTILITY_CONTAINERS_GRIDLAYOUT_H
+
+#include <algorithm>
+#include <bit>
+
+#include "Math/Vector.h"
+
+// Layouts decide where each cell of a Grid is stored. Each has an Indexer built from the grid's
+// size that turns a location into an index into the grid's Count() cells. Every layout stores
+// exactly Count() cells, so Data() and iteration cover each cell once, in storage order.
+
+// The first dimension varies fastest, so rows are contiguous.
+struct RowMajorGridLayout {
+  template <int Dimensions>
+  class Indexer {
+  public:
+    Indexer(void) = default;
+    Indexer(ivec<Dimensions> const & size) {
+      m_strides[0] = 1;
+      for (int i = 1; i < Dimensions; ++i) {
+        m_strides[i] = size[i - 1] * m_strides[i - 1];
+      }
+    }
+
+    int GetIndex(ivec<Dimensions> const & location) const {
+      return location.Dot(m_strides);
+    }
+
+  private:
+    ivec<Dimensions> m_strides;
+  };
+};
+
+// Splits the grid into tiles TileSize cells wide in every dimension and stores each tile
+// contiguously, so cells near each other usually share a cache line or page however the grid is
+// walked. Tiles are in row-major order. Tiles on the far edges are cut down to fit the grid rather
+// than padded. Inside a whole tile, cells are in Z-order when IsZOrder is set and row-major
+// otherwise. Cut down tiles are always row-major.
+template <int Dimensions, int TileSize, bool IsZOrder>
+class TiledGridIndexer {
+public:
+  static_assert(std::has_single_bit(unsigned(TileSize)), "TileSize must be a power of two");
+
+  TiledGridIndexer(void) = default;
+  TiledGridIndexer(ivec<Dimensions> const & size) :
+    m_size(size)
+  {
+    m_sliceCells[0] = TileSize;
+    for (int i = 1; i < Dimensions; ++i) {
+      m_sliceCells[i] = m_sliceCells[i - 1] * size[i - 1];
+    }
+
+    for (int i = 0; i < Dimensions; ++i) {
+      m_wholeEnd[i]     = size[i] & ~c_tileMask;
+      m_wholeStrides[i] = m_sliceCells[i] << ((Dimensions - 1 - i) * c_tileBits);
+    }
+  }
+
+  int GetIndex(ivec<Dimensions> const & location) const {
+    bool isWhole = true;
+    int  index   = 0;
+
+    for (int i = 0; i < Dimensions; ++i) {
+      isWhole &= location[i] < m_wholeEnd[i];
+      index   += (location[i] >> c_tileBits) * m_wholeStrides[i];
+    }
+
+    // Only the tiles on the far edges are cut down, so this is the common case by far.
+    if (isWhole) {
+      return index + GetIndexInWholeTile(location);
+    }
+
+    return GetIndexInCutTile(location);
+  }
+
+private:
+  static int const c_tileBits = std::countr_zero(unsigned(TileSize));
+  static int const c_tileMask = TileSize - 1;
+
+  static_assert(c_tileBits * Dimensions < 31, "Tiles must have fewer cells than an int can count");
+
+  static int GetIndexInWholeTile(ivec<Dimensions> const & location) {
+    int result = 0;
+
+    if constexpr (!IsZOrder) {
+      for (int i = 0; i < Dimensions; ++i) {
+        result |= (location[i] & c_tileMask) << (i * c_tileBits);
+      }
+    }
+    else if constexpr (Dimensions == 2 && c_tileBits <= 8) {
+      result = SpreadBits(location[0] & c_tileMask) | (SpreadBits(location[1] & c_tileMask) << 1);
+    }
+    else {
+      // Interleaves the bits of the location, first dimension lowest.
+      for (int bit = 0; bit < c_tileBits; ++bit) {
+        for (int i = 0; i < Dimensions; ++i) {
+          result |= ((location[i] >> bit) & 1) << (bit * Dimensions + i);
+        }
+      }
+    }
+
+    return result;
+  }
+
+  // Puts a zero bit between each of the low 8 bits of value.
+  static int SpreadBits(int value) {
+    value = (value | (value << 4)) & 0x0F0F;
+    value = (value | (value << 2)) & 0x3333;
+    value = (value | (value << 1)) & 0x5555;
+
+    return value;
+  }
+
+  // Working down from the last dimension, each tile coordinate skips whole slices of tiles that
+  // are as deep as the tiles picked so far. Cut down tiles are row-major inside.
+  int GetIndexInCutTile(ivec<Dimensions> const & location) const {
+    int index      = 0;
+    int tileCells  = 1;
+    int innerIndex = 0;
+    int innerScale = 1;
+
+    ivec<Dimensions> extents;
+
+    for (int i = Dimensions - 1; i >= 0; --i) {
+      int const tile = location[i] >> c_tileBits;
+
+      extents[i] = std::min(TileSize, m_size[i] - tile * TileSize);
+      index     += tile * m_sliceCells[i] * tileCells;
+      tileCells *= extents[i];
+    }
+
+    for (int i = 0; i < Dimensions; ++i) {
+      innerIndex += (location[i] & c_tileMask) * innerScale;
+      innerScale *= extents[i];
+    }
+
+    return index + innerIndex;
+  }
+
+  ivec<Dimensions> m_size;
+  ivec<Dimensions> m_sliceCells;
+  ivec<Dimensions> m_wholeEnd;
+  ivec<Dimensions> m_wholeStrides;
+};
+
+template <int TileSize>
+struct TiledGridLayout {
+  template <int Dimensions>
+  using Indexer = TiledGridIndexer<Dimensions, TileSize, false>;
+};
+
+// Z-order, or Morton order, keeps cells close in every direction close in memory at every scale up
+// to the tile, which suits neighborhood scans better than rows do.
+template <int TileSize>
+struct MortonGridLayout {
+  template <int Dimensions>
+  using Indexer = TiledGridIndexer<Dimensions, TileSize, true>;
+};
+
+#endif // DCUTILITY_CONTAINERS_GRIDLAYOUT_H
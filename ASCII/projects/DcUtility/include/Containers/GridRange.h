@@ -0,0 +1,214 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCUTILITY_CONTAINERS_GRIDRANGE_H
+#define DCUTILITY_CONTAINERS_GRIDRANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+#include "Math/Vector.h"
+
+// Ranges over the cells of a row-major box, given as its first cell, its size and the strides of
+// each dimension in cells, which is what Grid and GridView both have. They keep the location and
+// the cell pointer up to date as they go rather than working out an index for every cell.
+//
+//   for (auto [location, value] : grid.GetCells()) { ... }
+//   for (auto [location, cells] : grid.GetRows()) { for (T & value : cells) { ... } }
+//
+// Each row is contiguous, so looping over a row's span is a plain pointer loop the compiler can
+// vectorize. Hot loops that only need the location once per row should use GetRows.
+
+template <typename T, int Dimensions>
+struct GridCell {
+  ivec<Dimensions> location;
+  T &              value;
+};
+
+template <typename T, int Dimensions>
+struct GridRow {
+  // The location of the first cell in the row.
+  ivec<Dimensions> location;
+  std::span<T>     cells;
+};
+
+template <typename T, int Dimensions>
+class GridRowRange {
+public:
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = GridRow<T, Dimensions>;
+    using difference_type   = std::ptrdiff_t;
+
+    Iterator(void) = default;
+    Iterator(T * current, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) :
+      m_current(current),
+      m_size(size),
+      m_strides(strides)
+    {}
+
+    GridRow<T, Dimensions> operator *(void) const {
+      return { m_location, std::span<T>(m_current, m_size[0]) };
+    }
+
+    Iterator & operator ++(void) {
+      StepRow(m_current, m_location, m_size, m_strides);
+      return *this;
+    }
+
+    Iterator operator ++(int) {
+      Iterator const result = *this;
+      ++(*this);
+      return result;
+    }
+
+    bool operator ==(Iterator const & other) const {
+      return m_current == other.m_current;
+    }
+
+    bool operator !=(Iterator const & other) const {
+      return m_current != other.m_current;
+    }
+
+  private:
+    T *              m_current = nullptr;
+    ivec<Dimensions> m_size;
+    ivec<Dimensions> m_strides;
+    ivec<Dimensions> m_location;
+  };
+
+  // strides[0] has to be 1.
+  GridRowRange(T * data, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) :
+    m_data(data),
+    m_size(size),
+    m_strides(strides)
+  {}
+
+  Iterator begin(void) const {
+    return Iterator(m_data, m_size, m_strides);
+  }
+
+  Iterator end(void) const {
+    return Iterator(GetEnd(m_data, m_size, m_strides), m_size, m_strides);
+  }
+
+  // Moves current from the start of the row at location to the start of the next one. After the
+  // last row it's left at GetEnd.
+  static void StepRow(
+    T *&                     io_current,
+    ivec<Dimensions> &       io_location,
+    ivec<Dimensions> const & size,
+    ivec<Dimensions> const & strides
+  ) {
+    if constexpr (Dimensions == 1) {
+      io_current += size[0];
+    }
+    else {
+      io_current += strides[1];
+
+      // The last dimension never wraps, so the location ends up at size there, same as the pointer.
+      for (int i = 1; i < Dimensions; ++i) {
+        if (++io_location[i] != size[i] || i == Dimensions - 1) {
+          break;
+        }
+
+        io_location[i] = 0;
+        io_current    += strides[i + 1] - size[i] * strides[i];
+      }
+    }
+  }
+
+  // Where iterators end up after the last cell, or data when the box is empty.
+  static T * GetEnd(T * data, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) {
+    if (size.Product() == 0) {
+      return data;
+    }
+
+    return data + size[Dimensions - 1] * strides[Dimensions - 1];
+  }
+
+private:
+  T *              m_data;
+  ivec<Dimensions> m_size;
+  ivec<Dimensions> m_strides;
+};
+
+template <typename T, int Dimensions>
+class GridCellRange {
+public:
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = GridCell<T, Dimensions>;
+    using difference_type   = std::ptrdiff_t;
+
+    Iterator(void) = default;
+    Iterator(T * current, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) :
+      m_current(current),
+      m_size(size),
+      m_strides(strides)
+    {}
+
+    GridCell<T, Dimensions> operator *(void) const {
+      return { m_location, *m_current };
+    }
+
+    Iterator & operator ++(void) {
+      ++m_current;
+
+      if (++m_location[0] == m_size[0]) {
+        m_location[0] = 0;
+        m_current    -= m_size[0];
+
+        GridRowRange<T, Dimensions>::StepRow(m_current, m_location, m_size, m_strides);
+      }
+
+      return *this;
+    }
+
+    Iterator operator ++(int) {
+      Iterator const result = *this;
+      ++(*this);
+      return result;
+    }
+
+    bool operator ==(Iterator const & other) const {
+      return m_current == other.m_current;
+    }
+
+    bool operator !=(Iterator const & other) const {
+      return m_current != other.m_current;
+    }
+
+  private:
+    T *              m_current = nullptr;
+    ivec<Dimensions> m_size;
+    ivec<Dimensions> m_strides;
+    ivec<Dimensions> m_location;
+  };
+
+  // strides[0] has to be 1.
+  GridCellRange(T * data, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) :
+    m_data(data),
+    m_size(size),
+    m_strides(strides)
+  {}
+
+  Iterator begin(void) const {
+    return Iterator(m_data, m_size, m_strides);
+  }
+
+  Iterator end(void) const {
+    return Iterator(GridRowRange<T, Dimensions>::GetEnd(m_data, m_size, m_strides), m_size, m_strides);
+  }
+
+private:
+  T *              m_data;
+  ivec<Dimensions> m_size;
+  ivec<Dimensions> m_strides;
+};
+
+#endif // DCUTILITY_CONTAINERS_GRIDRANGE_H
@@ -0,0 +1,202 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCUTILITY_CONTAINERS_GRIDVIEW_H
+#define DCUTILITY_CONTAINERS_GRIDVIEW_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "Containers/Grid.h"
+#include "Containers/GridRange.h"
+#include "Math/Vector.h"
+
+// A box of cells inside a row-major Grid, used in place without copying. Locations are relative
+// to the box. T is const for a read-only view, which ConstGridView spells out. The view holds a
+// pointer into the grid, so it's only valid until the grid is resized or destroyed.
+template <typename T, int Dimensions>
+class GridView {
+public:
+  // Visits the cells of the view in row-major order, stepping over the parts of each row that are
+  // outside it.
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::remove_const_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T *;
+    using reference         = T &;
+
+    Iterator(void) = default;
+    Iterator(T * current, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) :
+      m_current(current),
+      m_size(size),
+      m_strides(strides)
+    {}
+
+    T & operator *(void) const {
+      return *m_current;
+    }
+
+    T * operator ->(void) const {
+      return m_current;
+    }
+
+    Iterator & operator ++(void) {
+      m_current += m_strides[0];
+
+      for (int i = 0; i < Dimensions - 1 && ++m_location[i] == m_size[i]; ++i) {
+        m_location[i] = 0;
+        m_current    += m_strides[i + 1] - m_size[i] * m_strides[i];
+      }
+
+      return *this;
+    }
+
+    Iterator operator ++(int) {
+      Iterator const result = *this;
+      ++(*this);
+      return result;
+    }
+
+    bool operator ==(Iterator const & other) const {
+      return m_current == other.m_current;
+    }
+
+    bool operator !=(Iterator const & other) const {
+      return m_current != other.m_current;
+    }
+
+  private:
+    T *              m_current = nullptr;
+    ivec<Dimensions> m_size;
+    ivec<Dimensions> m_strides;
+    ivec<Dimensions> m_location;
+  };
+
+  GridView(void) = default;
+
+  // strides are in cells, one per dimension.
+  GridView(T * data, ivec<Dimensions> const & size, ivec<Dimensions> const & strides) :
+    m_data(data),
+    m_size(size),
+    m_strides(strides)
+  {}
+
+  template <typename U>
+  requires (std::is_same_v<std::remove_const_t<T>, U>)
+  GridView(Grid<U, Dimensions> & grid) :
+    GridView(grid, ivec<Dimensions>(), grid.GetSize())
+  {}
+
+  template <typename U>
+  requires (std::is_const_v<T> && std::is_same_v<std::remove_const_t<T>, U>)
+  GridView(Grid<U, Dimensions> const & grid) :
+    GridView(grid, ivec<Dimensions>(), grid.GetSize())
+  {}
+
+  // The size cells of grid starting at offset. The box has to be inside the grid.
+  template <typename U>
+  requires (std::is_same_v<std::remove_const_t<T>, U>)
+  GridView(Grid<U, Dimensions> & grid, ivec<Dimensions> const & offset, ivec<Dimensions> const & size) :
+    GridView(grid.Data(), grid.GetSize(), offset, size)
+  {}
+
+  template <typename U>
+  requires (std::is_const_v<T> && std::is_same_v<std::remove_const_t<T>, U>)
+  GridView(Grid<U, Dimensions> const & grid, ivec<Dimensions> const & offset, ivec<Dimensions> const & size) :
+    GridView(grid.Data(), grid.GetSize(), offset, size)
+  {}
+
+  // A writable view can always be read from.
+  template <typename U>
+  requires (std::is_const_v<T> && std::is_same_v<std::remove_const_t<T>, U>)
+  GridView(GridView<U, Dimensions> const & view) :
+    m_data(view.Data()),
+    m_size(view.GetSize()),
+    m_strides(view.GetStrides())
+  {}
+
+  T & operator [](ivec<Dimensions> const & location) const {
+    return m_data[location.Dot(m_strides)];
+  }
+
+  // The size cells of this view starting at offset.
+  GridView GetSubView(ivec<Dimensions> const & offset, ivec<Dimensions> const & size) const {
+    return GridView(m_data + offset.Dot(m_strides), size, m_strides);
+  }
+
+  // Every cell with its location in the view. See GridRange.h.
+  GridCellRange<T, Dimensions> GetCells(void) const {
+    return GridCellRange<T, Dimensions>(m_data, m_size, m_strides);
+  }
+
+  // Every row of the view as a span, with the location of its first cell.
+  GridRowRange<T, Dimensions> GetRows(void) const {
+    return GridRowRange<T, Dimensions>(m_data, m_size, m_strides);
+  }
+
+  // The first cell of the view. Only rows are contiguous, so anything past the end of the first
+  // row has to be reached through the strides.
+  T * Data(void) const {
+    return m_data;
+  }
+
+  ivec<Dimensions> GetSize(void) const {
+    return m_size;
+  }
+
+  ivec<Dimensions> GetStrides(void) const {
+    return m_strides;
+  }
+
+  int Count(void) const {
+    return m_size.Product();
+  }
+
+  bool Empty(void) const {
+    return Count() == 0;
+  }
+
+  Iterator begin(void) const {
+    return Empty() ? end() : Iterator(m_data, m_size, m_strides);
+  }
+
+  Iterator end(void) const {
+    if (Empty()) {
+      return Iterator(m_data, m_size, m_strides);
+    }
+
+    return Iterator(m_data + m_size[Dimensions - 1] * m_strides[Dimensions - 1], m_size, m_strides);
+  }
+
+private:
+  GridView(T * gridData, ivec<Dimensions> const & gridSize, ivec<Dimensions> const & offset, ivec<Dimensions> const & size) :
+    m_data(gridData),
+    m_size(size)
+  {
+    m_strides[0] = 1;
+    for (int i = 1; i < Dimensions; ++i) {
+      m_strides[i] = gridSize[i - 1] * m_strides[i - 1];
+    }
+
+    m_data += offset.Dot(m_strides);
+  }
+
+  T *              m_data = nullptr;
+  ivec<Dimensions> m_size;
+  ivec<Dimensions> m_strides;
+};
+
+template <typename U, int Dimensions>
+GridView(Grid<U, Dimensions> &) -> GridView<U, Dimensions>;
+
+template <typename U, int Dimensions>
+GridView(Grid<U, Dimensions> const &) -> GridView<U const, Dimensions>;
+
+template <typename T, int Dimensions>
+using ConstGridView = GridView<T const, Dimensions>;
+
+#endif // DCUTILITY_CONTAINERS_GRIDVIEW_H
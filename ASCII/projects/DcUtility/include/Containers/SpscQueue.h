@@ -0,0 +1,75 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCUTILITY_CONTAINERS_SPSCQUEUE_H
+#define DCUTILITY_CONTAINERS_SPSCQUEUE_H
+
+#include <atomic>
+
+// A bounded queue for exactly one producer thread and one consumer thread. Neither side locks or
+// allocates. Pushing into a full queue fails rather than waiting.
+template <typename T, int Capacity>
+class SpscQueue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+public:
+  SpscQueue(void) = default;
+
+  SpscQueue(SpscQueue const &) = delete;
+  SpscQueue & operator =(SpscQueue const &) = delete;
+
+  // Producer side.
+  bool TryPush(T const & value) {
+    unsigned int const tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_head.load(std::memory_order_acquire) == unsigned(Capacity)) {
+      return false;
+    }
+
+    m_values[tail & c_indexMask] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  // Consumer side.
+  bool TryPop(T & o_value) {
+    return PopInto(&o_value, 1) == 1;
+  }
+
+  // Moves up to maxCount values into o_values and returns how many were moved.
+  int PopInto(T * o_values, int maxCount) {
+    unsigned int const head      = m_head.load(std::memory_order_relaxed);
+    unsigned int const available = m_tail.load(std::memory_order_acquire) - head;
+    int const          count     = available < unsigned(maxCount) ? int(available) : maxCount;
+
+    for (int i = 0; i < count; ++i) {
+      o_values[i] = m_values[(head + i) & c_indexMask];
+    }
+
+    m_head.store(head + count, std::memory_order_release);
+
+    return count;
+  }
+
+  // Only exact when called from the producer or consumer while the other side is idle.
+  int Count(void) const {
+    return int(m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire));
+  }
+
+  bool IsEmpty(void) const {
+    return Count() == 0;
+  }
+
+private:
+  static unsigned int const c_indexMask = unsigned(Capacity) - 1;
+
+  // Kept on separate cache lines so the two threads don't keep stealing the line from each other.
+  alignas(64) std::atomic<unsigned int> m_head = 0;
+  alignas(64) std::atomic<unsigned int> m_tail = 0;
+
+  T m_values[Capacity];
+};
+
+#endif // DCUTILITY_CONTAINERS_SPSCQUEUE_H
@@ -0,0 +1,63 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#ifndef DCUTILITY_CONTAINERS_TRIPLEBUFFER_H
+#define DCUTILITY_CONTAINERS_TRIPLEBUFFER_H
+
+#include <atomic>
+
+// Hands values from one producer thread to one consumer thread without locking. The producer
+// always has a slot to write into and the consumer always sees the newest published value, so
+// neither side ever waits on the other. Values published faster than they are consumed are
+// dropped.
+template <typename T>
+class TripleBuffer {
+public:
+  TripleBuffer(void) = default;
+
+  TripleBuffer(TripleBuffer const &) = delete;
+  TripleBuffer & operator =(TripleBuffer const &) = delete;
+
+  // Producer side.
+  T & GetWriteBuffer(void) {
+    return m_buffers[m_writeIndex];
+  }
+
+  void Publish(void) {
+    int const previous = m_shared.exchange(m_writeIndex | c_newBit, std::memory_order_acq_rel);
+
+    m_writeIndex = previous & c_indexMask;
+  }
+
+  // Consumer side. Returns false when nothing new was published since the last call.
+  bool Consume(void) {
+    if (!(m_shared.load(std::memory_order_relaxed) & c_newBit)) {
+      return false;
+    }
+
+    int const previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+
+    m_readIndex = previous & c_indexMask;
+    return true;
+  }
+
+  T const & GetReadBuffer(void) const {
+    return m_buffers[m_readIndex];
+  }
+
+  T & GetReadBuffer(void) {
+    return m_buffers[m_readIndex];
+  }
+
+private:
+  static int const c_indexMask = 0x3;
+  static int const c_newBit    = 0x4;
+
+  T                m_buffers[3];
+  int              m_writeIndex = 0;
+  int              m_readIndex  = 1;
+  std::atomic<int> m_shared     = 2;
+};
+
+#endif // DCUTILITY_CONTAINERS_TRIPLEBUFFER_H
@@ -0,0 +1,209 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Containers/GridAlgorithms.h"
+#include "Helpers/GridHelpers.h"
+#include "gtest/gtest.h"
+
+namespace {
+  // Splits even tiny grids across threads.
+  GridParallelism const c_threaded = { 4, 0 };
+}
+
+TEST(GridAlgorithmsTest, SubView_FillGrid_OnlyViewChanges) {
+  Grid<int, 2> grid(ivec2(6, 5), 0);
+
+  FillGrid(GridView<int, 2>(grid, ivec2(1, 1), ivec2(3, 2)), 7);
+
+  EXPECT_EQ(grid[ivec2(1, 1)], 7);
+  EXPECT_EQ(grid[ivec2(3, 2)], 7);
+  EXPECT_EQ(grid[ivec2(4, 2)], 0);
+  EXPECT_EQ(grid[ivec2(1, 3)], 0);
+  EXPECT_EQ(CountGridCells(grid, 7), 6);
+}
+
+TEST(GridAlgorithmsTest, ThreadedGrid_FillGrid_EveryCellSet) {
+  Grid<int, 3> grid(ivec3(5, 7, 3), 0);
+
+  FillGrid(grid, 2, c_threaded);
+
+  EXPECT_EQ(CountGridCells(grid, 2, c_threaded), grid.Count());
+}
+
+TEST(GridAlgorithmsTest, AnyParallelism_GetGridRowBlocks_MatchesBlocksRun) {
+  for (GridParallelism const & parallelism : { GridParallelism(), c_threaded }) {
+    ivec2 const         size(3, 37);
+    GridRowBlocks const blocks = GetGridRowBlocks(size, parallelism);
+    std::vector<int>    rowVisits(size.y, 0);
+
+    int const blockCount = ForEachGridRowBlock(size, parallelism, [&](int beginRow, int endRow, int block) {
+      EXPECT_LT(block, blocks.blockCount);
+
+      for (int row = beginRow; row < endRow; ++row) {
+        ++rowVisits[row];
+      }
+    });
+
+    EXPECT_EQ(blockCount, blocks.blockCount);
+    EXPECT_EQ(std::count(rowVisits.begin(), rowVisits.end(), 1), size.y);
+  }
+
+  EXPECT_EQ(GetGridRowBlocks(ivec2(3, 37), GridParallelism()).blockCount, 1);
+  EXPECT_EQ(GetGridRowBlocks(ivec2(0, 37), c_threaded).blockCount, 0);
+}
+
+TEST(GridAlgorithmsTest, ThreadThrows_ForEachGridRowBlock_RethrownOnCaller) {
+  Grid<int, 2> grid(ivec2(4, 64), 0);
+
+  EXPECT_THROW(
+    TransformGridWithLocation(grid, [](ivec2 const & location, int) {
+      if (location.y == 40) {
+        throw std::runtime_error("row 40");
+      }
+
+      return 1;
+    }, c_threaded),
+    std::runtime_error
+  );
+}
+
+TEST(GridAlgorithmsTest, TwoGrids_TransformGrid_DestHoldsResults) {
+  Grid<int, 2> const source = MakeNumberedGrid(ivec2(4, 3));
+  Grid<int, 2>       dest(ivec2(4, 3));
+
+  TransformGrid(source, dest, [](int value) { return value * 2; }, c_threaded);
+
+  EXPECT_EQ(dest[ivec2(0, 0)], 0);
+  EXPECT_EQ(dest[ivec2(3, 2)], 22);
+}
+
+TEST(GridAlgorithmsTest, AnyGrid_TransformGridWithLocation_SeesLocations) {
+  Grid<int, 3> grid(ivec3(3, 4, 2), 1);
+
+  TransformGridWithLocation(grid, [](ivec3 const & location, int value) { return value + location.x + location.y * 10 + location.z * 100; }, c_threaded);
+
+  EXPECT_EQ(grid[ivec3(0, 0, 0)], 1);
+  EXPECT_EQ(grid[ivec3(2, 3, 1)], 133);
+}
+
+TEST(GridAlgorithmsTest, ThreadedGrid_ReduceGrid_MatchesSerial) {
+  Grid<int, 2> const grid = MakeNumberedGrid(ivec2(13, 11));
+
+  auto const add = [](int64_t total, int64_t value) { return total + value; };
+  auto const max = [](int best, int value) { return std::max(best, value); };
+
+  EXPECT_EQ(ReduceGrid(grid, int64_t(0), add), 10153);
+  EXPECT_EQ(ReduceGrid(grid, int64_t(0), add, c_threaded), 10153);
+  EXPECT_EQ(ReduceGrid(grid, -1, max, c_threaded), 142);
+}
+
+TEST(GridAlgorithmsTest, EmptyGrid_ReduceGrid_IsIdentity) {
+  Grid<int, 2> const grid;
+
+  EXPECT_EQ(ReduceGrid(grid, 5, [](int total, int value) { return total + value; }, c_threaded), 5);
+  EXPECT_EQ(CountGridCells(grid, 0), 0);
+}
+
+TEST(GridAlgorithmsTest, AnyGrid_CountGridCellsIf_CountsMatches) {
+  Grid<int, 2> const grid = MakeNumberedGrid(ivec2(10, 10));
+
+  EXPECT_EQ(CountGridCellsIf(grid, [](int value) { return value % 3 == 0; }, c_threaded), 34);
+}
+
+TEST(GridAlgorithmsTest, SubViews_CopyGrid_BlitsRegion) {
+  Grid<int, 2> const source = MakeNumberedGrid(ivec2(5, 5));
+  Grid<int, 2>       dest(ivec2(8, 8), -1);
+
+  CopyGrid(ConstGridView<int, 2>(source, ivec2(1, 1), ivec2(3, 2)), GridView<int, 2>(dest, ivec2(4, 5), ivec2(3, 2)), c_threaded);
+
+  EXPECT_EQ(dest[ivec2(4, 5)], 6);
+  EXPECT_EQ(dest[ivec2(6, 6)], 13);
+  EXPECT_EQ(dest[ivec2(3, 5)], -1);
+  EXPECT_EQ(dest[ivec2(7, 6)], -1);
+  EXPECT_EQ(CountGridCells(dest, -1), 58);
+}
+
+TEST(GridAlgorithmsTest, StringGrids_CopyGrid_ValuesCopied) {
+  Grid<std::string, 2> const source(ivec2(3, 2), "a");
+  Grid<std::string, 2>       dest(ivec2(3, 2));
+
+  CopyGrid(source, dest);
+
+  EXPECT_EQ(CountGridCells(dest, std::string("a")), 6);
+}
+
+TEST(GridAlgorithmsTest, CharGridIntoIntGrid_CopyGrid_ValuesConverted) {
+  Grid<char, 2> source(ivec2(4, 2));
+  for (int i = 0; i < source.Count(); ++i) {
+    source.Data()[i] = char(i + 1);
+  }
+
+  Grid<int, 2> dest(ivec2(4, 2), 0);
+  CopyGrid(source, dest);
+
+  for (int i = 0; i < dest.Count(); ++i) {
+    EXPECT_EQ(dest.Data()[i], i + 1);
+  }
+}
+
+TEST(GridAlgorithmsTest, IntGridIntoCharGrid_CopyGrid_ValuesConverted) {
+  Grid<int, 2> const source = MakeNumberedGrid(ivec2(4, 2));
+  Grid<char, 2>      dest(ivec2(4, 2), 0);
+
+  CopyGrid(source, dest);
+
+  for (int i = 0; i < dest.Count(); ++i) {
+    EXPECT_EQ(dest.Data()[i], char(i));
+  }
+}
+
+TEST(GridAlgorithmsTest, IntAndCharGridsWithSameValues_AreGridsEqual_True) {
+  Grid<int, 2> const a = MakeNumberedGrid(ivec2(4, 2));
+  Grid<char, 2>      b(ivec2(4, 2));
+  for (int i = 0; i < b.Count(); ++i) {
+    b.Data()[i] = char(i);
+  }
+
+  EXPECT_TRUE(AreGridsEqual(a, b));
+  EXPECT_TRUE(AreGridsEqual(b, a));
+
+  b[ivec2(3, 1)] = 0;
+  EXPECT_FALSE(AreGridsEqual(a, b));
+}
+
+TEST(GridAlgorithmsTest, SameGrids_AreGridsEqual_True) {
+  Grid<int, 2> const a = MakeNumberedGrid(ivec2(9, 7));
+  Grid<int, 2> const b = MakeNumberedGrid(ivec2(9, 7));
+
+  EXPECT_TRUE(AreGridsEqual(a, b));
+  EXPECT_TRUE(AreGridsEqual(a, b, c_threaded));
+}
+
+TEST(GridAlgorithmsTest, DifferentGrids_AreGridsEqual_False) {
+  Grid<int, 2> const a = MakeNumberedGrid(ivec2(9, 7));
+  Grid<int, 2>       b = MakeNumberedGrid(ivec2(9, 7));
+  b[ivec2(8, 6)] = 0;
+
+  EXPECT_FALSE(AreGridsEqual(a, b));
+  EXPECT_FALSE(AreGridsEqual(a, b, c_threaded));
+  EXPECT_FALSE(AreGridsEqual(a, MakeNumberedGrid(ivec2(7, 9))));
+}
+
+TEST(GridAlgorithmsTest, ChangedCells_FindGridDifferences_LocationsInRowOrder) {
+  Grid<int, 2> const previous = MakeNumberedGrid(ivec2(6, 9));
+  Grid<int, 2>       current  = previous;
+  current[ivec2(5, 7)] = -1;
+  current[ivec2(0, 0)] = -1;
+  current[ivec2(2, 3)] = -1;
+
+  std::vector<ivec2> locations;
+  FindGridDifferences(previous, current, locations, c_threaded);
+
+  EXPECT_EQ(locations, std::vector<ivec2>({ ivec2(0, 0), ivec2(2, 3), ivec2(5, 7) }));
+}
@@ -0,0 +1,103 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <vector>
+
+#include "Containers/Grid.h"
+#include "gtest/gtest.h"
+
+namespace {
+  // Whether the layout puts every location of a grid of size at its own index below its count.
+  template <int Dimensions, typename Layout>
+  bool IsLayoutOneToOne(ivec<Dimensions> const & size) {
+    typename Layout::template Indexer<Dimensions> const indexer(size);
+    std::vector<bool>                                   isUsed(size.Product(), false);
+
+    for (ivec<Dimensions> i; i != size; i = Grid<int, Dimensions>::GetNextCoord(i, size)) {
+      int const index = indexer.GetIndex(i);
+
+      if (index < 0 || index >= size.Product() || isUsed[index]) {
+        return false;
+      }
+
+      isUsed[index] = true;
+    }
+
+    return true;
+  }
+}
+
+TEST(GridLayoutTest, RowMajorLayout_GetIndex_MatchesNextCoordOrder) {
+  RowMajorGridLayout::Indexer<2> const indexer(ivec2(5, 3));
+
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 0)), 0);
+  EXPECT_EQ(indexer.GetIndex(ivec2(4, 0)), 4);
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 1)), 5);
+  EXPECT_EQ(indexer.GetIndex(ivec2(3, 2)), 13);
+}
+
+TEST(GridLayoutTest, TiledLayout_GetIndex_TilesAreContiguous) {
+  TiledGridLayout<4>::Indexer<2> const indexer(ivec2(8, 8));
+
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 0)), 0);
+  EXPECT_EQ(indexer.GetIndex(ivec2(3, 0)), 3);
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 1)), 4);
+  EXPECT_EQ(indexer.GetIndex(ivec2(3, 3)), 15);
+  EXPECT_EQ(indexer.GetIndex(ivec2(4, 0)), 16);
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 4)), 32);
+}
+
+TEST(GridLayoutTest, TiledLayoutWithCutTiles_GetIndex_EdgeTilesArePacked) {
+  TiledGridLayout<4>::Indexer<2> const indexer(ivec2(6, 5));
+
+  EXPECT_EQ(indexer.GetIndex(ivec2(4, 0)), 16);
+  EXPECT_EQ(indexer.GetIndex(ivec2(4, 1)), 18);
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 4)), 24);
+  EXPECT_EQ(indexer.GetIndex(ivec2(5, 4)), 29);
+}
+
+TEST(GridLayoutTest, MortonLayout_GetIndex_InterleavesBitsInTile) {
+  MortonGridLayout<4>::Indexer<2> const indexer(ivec2(8, 8));
+
+  EXPECT_EQ(indexer.GetIndex(ivec2(1, 0)), 1);
+  EXPECT_EQ(indexer.GetIndex(ivec2(0, 1)), 2);
+  EXPECT_EQ(indexer.GetIndex(ivec2(1, 1)), 3);
+  EXPECT_EQ(indexer.GetIndex(ivec2(2, 0)), 4);
+  EXPECT_EQ(indexer.GetIndex(ivec2(3, 3)), 15);
+  EXPECT_EQ(indexer.GetIndex(ivec2(5, 0)), 17);
+}
+
+TEST(GridLayoutTest, OddSizes_GetIndex_EveryLocationHasItsOwnIndex) {
+  EXPECT_TRUE((IsLayoutOneToOne<2, TiledGridLayout<4>>(ivec2(13, 10))));
+  EXPECT_TRUE((IsLayoutOneToOne<2, MortonGridLayout<8>>(ivec2(13, 10))));
+  EXPECT_TRUE((IsLayoutOneToOne<3, TiledGridLayout<2>>(ivec3(5, 4, 3))));
+  EXPECT_TRUE((IsLayoutOneToOne<3, MortonGridLayout<4>>(ivec3(9, 5, 7))));
+  EXPECT_TRUE((IsLayoutOneToOne<1, MortonGridLayout<4>>(ivec1(11))));
+}
+
+TEST(GridLayoutTest, MortonGrid_SizeSetToLarger_ValuesAreKept) {
+  Grid<int, 2, MortonGridLayout<4>> grid(ivec2(5, 5), -1);
+  grid[ivec2(0, 0)] = 1;
+  grid[ivec2(4, 1)] = 2;
+  grid[ivec2(2, 4)] = 3;
+
+  grid.SetSize(ivec2(9, 6));
+
+  EXPECT_EQ(grid[ivec2(0, 0)], 1);
+  EXPECT_EQ(grid[ivec2(4, 1)], 2);
+  EXPECT_EQ(grid[ivec2(2, 4)], 3);
+  EXPECT_EQ(grid[ivec2(3, 3)], -1);
+  EXPECT_EQ(grid[ivec2(8, 5)], 0);
+}
+
+TEST(GridLayoutTest, TiledGrid_RangeBasedFor_IteratesOverAll) {
+  Grid<int, 2, TiledGridLayout<8>> grid(ivec2(20, 11), 1);
+
+  int total = 0;
+  for (int const & value : grid) {
+    total += value;
+  }
+
+  EXPECT_EQ(total, 220);
+}
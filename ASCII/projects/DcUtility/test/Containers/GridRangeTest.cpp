@@ -0,0 +1,115 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <iterator>
+#include <vector>
+
+#include "Containers/GridView.h"
+#include "gtest/gtest.h"
+
+TEST(GridRangeTest, MultidimensionalGrid_GetCells_MatchNextCoordOrder) {
+  Grid<int, 3> grid(ivec3(3, 2, 4));
+  for (int i = 0; i < grid.Count(); ++i) {
+    grid.Data()[i] = i;
+  }
+
+  ivec3 expected;
+  int   count = 0;
+  for (auto [location, value] : grid.GetCells()) {
+    EXPECT_EQ(location, expected);
+    EXPECT_EQ(value, grid[expected]);
+
+    expected = grid.GetNextCoord(expected, grid.GetSize());
+    ++count;
+  }
+
+  EXPECT_EQ(count, grid.Count());
+}
+
+TEST(GridRangeTest, AnyGrid_WriteThroughCells_GridChanges) {
+  Grid<int, 2> grid(ivec2(4, 3), 0);
+
+  for (auto [location, value] : grid.GetCells()) {
+    value = location.x + location.y * 10;
+  }
+
+  EXPECT_EQ(grid[ivec2(3, 2)], 23);
+  EXPECT_EQ(grid[ivec2(1, 1)], 11);
+}
+
+TEST(GridRangeTest, MultidimensionalGrid_GetRows_RowsAreContiguous) {
+  Grid<int, 3> const grid(ivec3(5, 3, 2), 1);
+
+  ivec3 expected;
+  int   count = 0;
+  for (auto [location, cells] : grid.GetRows()) {
+    EXPECT_EQ(location, expected);
+    EXPECT_EQ(cells.data(), &grid[location]);
+    EXPECT_EQ(int(cells.size()), 5);
+
+    expected = grid.GetNextCoord(expected, ivec3(1, 3, 2));
+    ++count;
+  }
+
+  EXPECT_EQ(count, 6);
+}
+
+TEST(GridRangeTest, SingleDimensionGrid_GetRows_OneRow) {
+  Grid<int, 1> const grid(ivec1(7), 2);
+
+  int count = 0;
+  for (auto [location, cells] : grid.GetRows()) {
+    EXPECT_EQ(location, ivec1(0));
+    EXPECT_EQ(int(cells.size()), 7);
+    ++count;
+  }
+
+  EXPECT_EQ(count, 1);
+}
+
+TEST(GridRangeTest, EmptyGrid_GetCellsAndRows_NothingVisited) {
+  Grid<int, 2> const grid(ivec2(0, 4));
+
+  auto const cells = grid.GetCells();
+  auto const rows  = grid.GetRows();
+
+  EXPECT_EQ(std::distance(cells.begin(), cells.end()), 0);
+  EXPECT_EQ(std::distance(rows.begin(), rows.end()), 0);
+}
+
+TEST(GridRangeTest, SubView_GetCells_LocationsAreRelativeToView) {
+  Grid<int, 2>           grid(ivec2(6, 5), 0);
+  GridView<int, 2> const view(grid, ivec2(2, 1), ivec2(3, 2));
+
+  std::vector<ivec2> locations;
+  for (auto [location, value] : view.GetCells()) {
+    locations.emplace_back(location);
+    value = 1;
+  }
+
+  EXPECT_EQ(locations, std::vector<ivec2>({ ivec2(0, 0), ivec2(1, 0), ivec2(2, 0), ivec2(0, 1), ivec2(1, 1), ivec2(2, 1) }));
+  EXPECT_EQ(grid[ivec2(4, 2)], 1);
+  EXPECT_EQ(grid[ivec2(5, 2)], 0);
+  EXPECT_EQ(grid[ivec2(2, 3)], 0);
+}
+
+TEST(GridRangeTest, SubView_GetRows_SpansCoverOnlyTheView) {
+  Grid<int, 3>           grid(ivec3(4, 4, 4), 0);
+  GridView<int, 3> const view(grid, ivec3(1, 1, 1), ivec3(2, 2, 3));
+
+  for (auto [location, cells] : view.GetRows()) {
+    for (int & value : cells) {
+      ++value;
+    }
+  }
+
+  int total = 0;
+  for (int const value : grid) {
+    total += value;
+  }
+
+  EXPECT_EQ(total, 12);
+  EXPECT_EQ(grid[ivec3(2, 2, 3)], 1);
+  EXPECT_EQ(grid[ivec3(3, 2, 3)], 0);
+}
@@ -2,9 +2,42 @@
  * Copywrite 2021 Dodge Lafnitzegger
  */
 
+#include <string>
+
 #include "Containers/Grid.h"
 #include "gtest/gtest.h"
 
+namespace {
+  int GetCellValue(ivec3 const & location) {
+    return 1 + location.x + location.y * 10 + location.z * 100;
+  }
+
+  // Whether resizing from one size to another keeps the shared cells and zeroes the rest. Sizes
+  // have to have no zeros.
+  bool IsResizeCorrect(ivec3 const & fromSize, ivec3 const & toSize) {
+    Grid<int, 3> grid(fromSize);
+    for (ivec3 i; i != fromSize; i = grid.GetNextCoord(i, fromSize)) {
+      grid[i] = GetCellValue(i);
+    }
+
+    grid.SetSize(toSize);
+
+    if (grid.GetSize() != toSize || grid.Count() != toSize.Product()) {
+      return false;
+    }
+
+    for (ivec3 i; i != toSize; i = grid.GetNextCoord(i, toSize)) {
+      bool const isKept = i.x < fromSize.x && i.y < fromSize.y && i.z < fromSize.z;
+
+      if (grid[i] != (isKept ? GetCellValue(i) : 0)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+}
+
 TEST(GridTest, MultidimensionalGrid_GetNextCoord_IsRowMajor) {
   ivec3 const coord0 = ivec3(0, 0, 0);
   ivec3 const coord1 = ivec3(1, 0, 0);
@@ -213,3 +246,60 @@ TEST(GridTest, AnyGrid_Clear_SizeIs0) {
   ASSERT_EQ(grid.GetSize(), ivec4(0, 0, 0, 0));
   ASSERT_EQ(grid.Count(), 0);
 }
+
+TEST(GridTest, MultidimensionalGrid_SizeSetToEveryMix_ValuesAreCorrect) {
+  ivec3 const sizes[] = {
+    ivec3(3, 4, 2), ivec3(5, 4, 2), ivec3(2, 4, 3), ivec3(3, 2, 3), ivec3(5, 5, 5), ivec3(1, 1, 1)
+  };
+
+  for (ivec3 const & fromSize : sizes) {
+    for (ivec3 const & toSize : sizes) {
+      EXPECT_TRUE(IsResizeCorrect(fromSize, toSize)) << fromSize.x << "x" << fromSize.y << "x" << fromSize.z
+        << " to " << toSize.x << "x" << toSize.y << "x" << toSize.z;
+    }
+  }
+}
+
+TEST(GridTest, StringGrid_SizeSetToLarger_ValuesAreMoved) {
+  Grid<std::string, 2> grid(ivec2(2, 2));
+  grid[ivec2(0, 0)] = "a";
+  grid[ivec2(1, 0)] = "b";
+  grid[ivec2(0, 1)] = "c";
+  grid[ivec2(1, 1)] = "d";
+
+  grid.SetSize(ivec2(3, 3));
+
+  EXPECT_EQ(grid[ivec2(0, 0)], "a");
+  EXPECT_EQ(grid[ivec2(1, 0)], "b");
+  EXPECT_EQ(grid[ivec2(2, 0)], "");
+  EXPECT_EQ(grid[ivec2(0, 1)], "c");
+  EXPECT_EQ(grid[ivec2(1, 1)], "d");
+  EXPECT_EQ(grid[ivec2(2, 1)], "");
+  EXPECT_EQ(grid[ivec2(0, 2)], "");
+}
+
+TEST(GridTest, ReservedGrid_SizeSetWithinCapacity_StorageIsReused) {
+  Grid<int, 2> grid(ivec2(4, 4), 1);
+  grid.Reserve(64);
+
+  int const * const data = grid.Data();
+
+  grid.SetSize(ivec2(8, 8));
+  EXPECT_EQ(grid.Data(), data);
+  EXPECT_GE(grid.GetCapacity(), 64);
+  EXPECT_EQ(grid[ivec2(3, 3)], 1);
+  EXPECT_EQ(grid[ivec2(4, 3)], 0);
+
+  grid.SetSize(ivec2(2, 2));
+  EXPECT_EQ(grid.Data(), data);
+  EXPECT_EQ(grid[ivec2(1, 1)], 1);
+}
+
+TEST(GridTest, EmptyGrid_SizeSetToLarger_ValuesAreDefault) {
+  Grid<int, 2> grid(ivec2(0, 3));
+
+  grid.SetSize(ivec2(2, 2));
+
+  EXPECT_EQ(grid[ivec2(0, 0)], 0);
+  EXPECT_EQ(grid[ivec2(1, 1)], 0);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <vector>
+
+#include "Containers/GridView.h"
+#include "Helpers/GridHelpers.h"
+#include "gtest/gtest.h"
+
+TEST(GridViewTest, WholeGrid_ReadLocations_MatchGrid) {
+  Grid<int, 2> const          grid = MakeNumberedGrid(ivec2(4, 3));
+  ConstGridView<int, 2> const view(grid);
+
+  EXPECT_EQ(view.GetSize(), ivec2(4, 3));
+  EXPECT_EQ(view[ivec2(0, 0)], 0);
+  EXPECT_EQ(view[ivec2(3, 2)], 11);
+}
+
+TEST(GridViewTest, SubRegion_ReadLocations_RelativeToOffset) {
+  Grid<int, 2> const          grid = MakeNumberedGrid(ivec2(5, 4));
+  ConstGridView<int, 2> const view(grid, ivec2(1, 2), ivec2(3, 2));
+
+  EXPECT_EQ(view.Count(), 6);
+  EXPECT_EQ(view[ivec2(0, 0)], 11);
+  EXPECT_EQ(view[ivec2(2, 1)], 18);
+}
+
+TEST(GridViewTest, SubRegion_WriteThroughView_GridChanges) {
+  Grid<int, 2>           grid(ivec2(5, 4), 0);
+  GridView<int, 2> const view(grid, ivec2(2, 1), ivec2(2, 2));
+
+  view[ivec2(1, 1)] = 7;
+
+  EXPECT_EQ(grid[ivec2(3, 2)], 7);
+}
+
+TEST(GridViewTest, SubRegion_RangeBasedFor_VisitsOnlyRegionInRowOrder) {
+  Grid<int, 2> const          grid = MakeNumberedGrid(ivec2(5, 4));
+  ConstGridView<int, 2> const view(grid, ivec2(1, 1), ivec2(3, 2));
+  std::vector<int>            visited;
+
+  for (int const value : view) {
+    visited.emplace_back(value);
+  }
+
+  EXPECT_EQ(visited, std::vector<int>({ 6, 7, 8, 11, 12, 13 }));
+}
+
+TEST(GridViewTest, ThreeDimensionalRegion_RangeBasedFor_VisitsEveryCellOnce) {
+  Grid<int, 3>           grid(ivec3(4, 4, 4), 0);
+  GridView<int, 3> const view(grid, ivec3(1, 1, 1), ivec3(2, 3, 2));
+
+  for (int & value : view) {
+    ++value;
+  }
+
+  int total = 0;
+  for (int const value : grid) {
+    total += value;
+  }
+
+  EXPECT_EQ(total, 12);
+  EXPECT_EQ(grid[ivec3(2, 3, 2)], 1);
+  EXPECT_EQ(grid[ivec3(3, 3, 2)], 0);
+}
+
+TEST(GridViewTest, EmptyRegion_RangeBasedFor_BeginIsEnd) {
+  Grid<int, 2> const          grid = MakeNumberedGrid(ivec2(5, 4));
+  ConstGridView<int, 2> const view(grid, ivec2(1, 1), ivec2(0, 2));
+
+  EXPECT_TRUE(view.Empty());
+  EXPECT_EQ(view.begin(), view.end());
+}
+
+TEST(GridViewTest, SubView_ReadLocations_OffsetsAdd) {
+  Grid<int, 2> const          grid = MakeNumberedGrid(ivec2(6, 6));
+  ConstGridView<int, 2> const view(grid, ivec2(1, 1), ivec2(4, 4));
+
+  ConstGridView<int, 2> const subView = view.GetSubView(ivec2(1, 2), ivec2(2, 2));
+
+  EXPECT_EQ(subView[ivec2(0, 0)], 20);
+  EXPECT_EQ(subView[ivec2(1, 1)], 27);
+}
+
+TEST(GridViewTest, WritableView_ConvertToConst_SeesSameCells) {
+  Grid<int, 2>                grid = MakeNumberedGrid(ivec2(3, 3));
+  GridView<int, 2> const      view(grid, ivec2(1, 1), ivec2(2, 2));
+  ConstGridView<int, 2> const constView = view;
+
+  EXPECT_EQ(constView[ivec2(1, 1)], 8);
+}
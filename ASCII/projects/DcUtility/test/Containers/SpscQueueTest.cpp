@@ -0,0 +1,115 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <thread>
+
+#include "Containers/SpscQueue.h"
+#include "gtest/gtest.h"
+
+TEST(SpscQueueTest, DefaultConstructed_TryPop_ReturnsFalse) {
+  SpscQueue<int, 4> queue;
+  int               value = 0;
+
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(SpscQueueTest, ValuesPushed_TryPop_ValuesComeOutInOrder) {
+  SpscQueue<int, 4> queue;
+
+  queue.TryPush(3);
+  queue.TryPush(1);
+  queue.TryPush(2);
+
+  int first  = 0;
+  int second = 0;
+  int third  = 0;
+
+  ASSERT_TRUE(queue.TryPop(first));
+  ASSERT_TRUE(queue.TryPop(second));
+  ASSERT_TRUE(queue.TryPop(third));
+  EXPECT_EQ(first, 3);
+  EXPECT_EQ(second, 1);
+  EXPECT_EQ(third, 2);
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(SpscQueueTest, FullQueue_TryPush_ReturnsFalse) {
+  SpscQueue<int, 2> queue;
+
+  EXPECT_TRUE(queue.TryPush(1));
+  EXPECT_TRUE(queue.TryPush(2));
+  EXPECT_FALSE(queue.TryPush(3));
+  EXPECT_EQ(queue.Count(), 2);
+}
+
+TEST(SpscQueueTest, QueueWrapsAround_PopInto_ValuesComeOutInOrder) {
+  SpscQueue<int, 4> queue;
+  int               value = 0;
+
+  for (int i = 0; i < 3; ++i) {
+    queue.TryPush(i);
+  }
+  queue.TryPop(value);
+  queue.TryPop(value);
+
+  for (int i = 3; i < 6; ++i) {
+    queue.TryPush(i);
+  }
+
+  int       values[8] = { 0 };
+  int const count     = queue.PopInto(values, 8);
+
+  ASSERT_EQ(count, 4);
+  EXPECT_EQ(values[0], 2);
+  EXPECT_EQ(values[1], 3);
+  EXPECT_EQ(values[2], 4);
+  EXPECT_EQ(values[3], 5);
+}
+
+TEST(SpscQueueTest, MoreValuesThanRoom_PopInto_StopsAtMaxCount) {
+  SpscQueue<int, 8> queue;
+
+  for (int i = 0; i < 5; ++i) {
+    queue.TryPush(i);
+  }
+
+  int values[2] = { 0 };
+
+  EXPECT_EQ(queue.PopInto(values, 2), 2);
+  EXPECT_EQ(queue.Count(), 3);
+}
+
+TEST(SpscQueueTest, SeparateThreads_PushAndPop_EveryValueArrivesInOrder) {
+  SpscQueue<int, 64> queue;
+  int const          valueCount = 100000;
+
+  std::thread producer([&queue]() {
+    for (int i = 0; i < valueCount; ++i) {
+      // Yields so the test doesn't starve the consumer when both share a core.
+      while (!queue.TryPush(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int  expected  = 0;
+  bool isInOrder = true;
+
+  while (expected < valueCount) {
+    int value = 0;
+
+    if (queue.TryPop(value)) {
+      isInOrder = isInOrder && value == expected;
+      ++expected;
+    }
+    else {
+      std::this_thread::yield();
+    }
+  }
+
+  producer.join();
+
+  EXPECT_TRUE(isInOrder);
+}
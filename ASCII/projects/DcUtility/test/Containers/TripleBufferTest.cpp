@@ -0,0 +1,88 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <thread>
+
+#include "Containers/TripleBuffer.h"
+#include "gtest/gtest.h"
+
+TEST(TripleBufferTest, NothingPublished_Consume_ReturnsFalse) {
+  TripleBuffer<int> buffer;
+
+  EXPECT_FALSE(buffer.Consume());
+}
+
+TEST(TripleBufferTest, ValuePublished_Consume_ReadsValue) {
+  TripleBuffer<int> buffer;
+
+  buffer.GetWriteBuffer() = 5;
+  buffer.Publish();
+
+  ASSERT_TRUE(buffer.Consume());
+  EXPECT_EQ(buffer.GetReadBuffer(), 5);
+}
+
+TEST(TripleBufferTest, ValueConsumed_ConsumeAgain_ReturnsFalseAndKeepsValue) {
+  TripleBuffer<int> buffer;
+
+  buffer.GetWriteBuffer() = 5;
+  buffer.Publish();
+  buffer.Consume();
+
+  EXPECT_FALSE(buffer.Consume());
+  EXPECT_EQ(buffer.GetReadBuffer(), 5);
+}
+
+TEST(TripleBufferTest, SeveralValuesPublished_Consume_ReadsNewest) {
+  TripleBuffer<int> buffer;
+
+  for (int i = 1; i <= 4; ++i) {
+    buffer.GetWriteBuffer() = i;
+    buffer.Publish();
+  }
+
+  ASSERT_TRUE(buffer.Consume());
+  EXPECT_EQ(buffer.GetReadBuffer(), 4);
+}
+
+TEST(TripleBufferTest, ValueBeingRead_Publish_WriteBufferIsNotReadBuffer) {
+  TripleBuffer<int> buffer;
+
+  buffer.GetWriteBuffer() = 1;
+  buffer.Publish();
+  buffer.Consume();
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NE(&buffer.GetWriteBuffer(), &buffer.GetReadBuffer());
+
+    buffer.GetWriteBuffer() = 2;
+    buffer.Publish();
+  }
+}
+
+TEST(TripleBufferTest, SeparateThreads_PublishIncreasingValues_ConsumerSeesIncreasingValues) {
+  TripleBuffer<int> buffer;
+  int const         lastValue = 100000;
+
+  std::thread producer([&buffer]() {
+    for (int i = 1; i <= lastValue; ++i) {
+      buffer.GetWriteBuffer() = i;
+      buffer.Publish();
+    }
+  });
+
+  int  previous     = 0;
+  bool isIncreasing = true;
+
+  while (previous != lastValue) {
+    if (buffer.Consume()) {
+      isIncreasing = isIncreasing && buffer.GetReadBuffer() > previous;
+      previous     = buffer.GetReadBuffer();
+    }
+  }
+
+  producer.join();
+
+  EXPECT_TRUE(isIncreasing);
+}
@@ -14,6 +14,10 @@ namespace {
   int const RedIndex   = 2;
   int const GreenIndex = 3;
 
+  // Hues around the color wheel, cycled by the window so the border sweeps without being redrawn.
+  int const RainbowBank    = 1;
+  int const RainbowCycleMs = 10000;
+
   float const Pi = 3.141592653589793238462643383279;
 
   Color ColorFromHueRotation(float hueAngle) {
@@ -84,19 +88,20 @@ int main(void) {
   font.colors[RedIndex]   = Color::Red;
   font.colors[GreenIndex] = Color::Green;
 
+  for (int i = 0; i < FontColorCount; ++i) {
+    font.colors[GetBankColor(RainbowBank, i)] = ColorFromHueRotation(2.0f * Pi * i / FontColorCount);
+  }
+
+  font.cycles[0] = PaletteCycle{ GetBankColor(RainbowBank, 0), FontColorCount, RainbowCycleMs / FontColorCount, true };
+
   window->SetFont(font);
 
   int const width  = 100;
   int const height = width / 2;
 
-  float const colorRotSpeed          = 0.01f;
-  int   const colorRotUpdateThrottle = 16;
-
   ivec2 const displayCharLocation = ivec2(3, 3);
   char        displayChar = ' ';
 
-  float colorRot = 0.0f;
-
   InputManager inputManager(window);
 
   auto buttonManager = inputManager.GetButtonManager();
@@ -508,21 +513,21 @@ int main(void) {
 
     for (int i = 0; i < width; ++i) {
       grid[ivec2(i, 0)].character = '-';
-      grid[ivec2(i, 0)].foregroundColor = WhiteIndex;
+      grid[ivec2(i, 0)].foregroundColor = GetBankColor(RainbowBank, i % FontColorCount);
       grid[ivec2(i, 0)].backgroundColor = BlackIndex;
 
       grid[ivec2(i, height - 1)].character = '-';
-      grid[ivec2(i, height - 1)].foregroundColor = WhiteIndex;
+      grid[ivec2(i, height - 1)].foregroundColor = GetBankColor(RainbowBank, i % FontColorCount);
       grid[ivec2(i, height - 1)].backgroundColor = BlackIndex;
     }
 
     for (int i = 0; i < height; ++i) {
       grid[ivec2(0, i)].character = '|';
-      grid[ivec2(0, i)].foregroundColor = WhiteIndex;
+      grid[ivec2(0, i)].foregroundColor = GetBankColor(RainbowBank, i % FontColorCount);
       grid[ivec2(0, i)].backgroundColor = BlackIndex;
 
       grid[ivec2(width - 1, i)].character = '|';
-      grid[ivec2(width - 1, i)].foregroundColor = WhiteIndex;
+      grid[ivec2(width - 1, i)].foregroundColor = GetBankColor(RainbowBank, i % FontColorCount);
       grid[ivec2(width - 1, i)].backgroundColor = BlackIndex;
     }
 
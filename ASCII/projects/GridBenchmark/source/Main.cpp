@@ -0,0 +1,279 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Containers/GridAlgorithms.h"
+
+namespace {
+  ivec2 const c_gridSize    = ivec2(4096, 4096);
+  int const   c_randomSpots = 4000000;
+  int const   c_repeats     = 3;
+
+  // What WaveFunctionCollapse does when it picks the next spot to collapse.
+  template <typename Layout>
+  int64_t ScanRandomNeighborhoods(Grid<int, 2, Layout> const & grid, std::vector<ivec2> const & spots) {
+    int64_t total = 0;
+
+    for (ivec2 const & spot : spots) {
+      for (int y = -1; y <= 1; ++y) {
+        for (int x = -1; x <= 1; ++x) {
+          total += grid[ivec2(spot.x + x, spot.y + y)];
+        }
+      }
+    }
+
+    return total;
+  }
+
+  // A cellular automaton step, visiting every cell's neighborhood in row order.
+  template <typename Layout>
+  int64_t SweepNeighborhoods(Grid<int, 2, Layout> const & grid) {
+    int64_t total = 0;
+
+    for (int y = 1; y < c_gridSize.y - 1; ++y) {
+      for (int x = 1; x < c_gridSize.x - 1; ++x) {
+        for (int dy = -1; dy <= 1; ++dy) {
+          for (int dx = -1; dx <= 1; ++dx) {
+            total += grid[ivec2(x + dx, y + dy)];
+          }
+        }
+      }
+    }
+
+    return total;
+  }
+
+  template <typename Layout>
+  int64_t WalkRows(Grid<int, 2, Layout> const & grid) {
+    int64_t total = 0;
+
+    for (int y = 0; y < c_gridSize.y; ++y) {
+      for (int x = 0; x < c_gridSize.x; ++x) {
+        total += grid[ivec2(x, y)];
+      }
+    }
+
+    return total;
+  }
+
+  template <typename Layout>
+  int64_t WalkColumns(Grid<int, 2, Layout> const & grid) {
+    int64_t total = 0;
+
+    for (int x = 0; x < c_gridSize.x; ++x) {
+      for (int y = 0; y < c_gridSize.y; ++y) {
+        total += grid[ivec2(x, y)];
+      }
+    }
+
+    return total;
+  }
+
+  // The loop most of the code base uses to visit every cell.
+  int64_t SumWithNextCoord(Grid<int, 2> const & grid) {
+    int64_t total = 0;
+
+    for (ivec2 i; i != grid.GetSize(); i = grid.GetNextCoord(i, grid.GetSize())) {
+      total += grid[i] + i.x;
+    }
+
+    return total;
+  }
+
+  int64_t SumWithCells(Grid<int, 2> const & grid) {
+    int64_t total = 0;
+
+    for (auto [location, value] : grid.GetCells()) {
+      total += value + location.x;
+    }
+
+    return total;
+  }
+
+  int64_t SumWithRows(Grid<int, 2> const & grid) {
+    int64_t total = 0;
+
+    for (auto [location, cells] : grid.GetRows()) {
+      int x = 0;
+      for (int const value : cells) {
+        total += value + x;
+        ++x;
+      }
+    }
+
+    return total;
+  }
+
+  // Writes every cell from its location, as when a screen is drawn.
+  int64_t FillWithNextCoord(Grid<int, 2> & io_grid) {
+    for (ivec2 i; i != io_grid.GetSize(); i = io_grid.GetNextCoord(i, io_grid.GetSize())) {
+      io_grid[i] = i.x ^ i.y;
+    }
+
+    return io_grid[ivec2(1, 1)];
+  }
+
+  int64_t FillWithCells(Grid<int, 2> & io_grid) {
+    for (auto [location, value] : io_grid.GetCells()) {
+      value = location.x ^ location.y;
+    }
+
+    return io_grid[ivec2(1, 1)];
+  }
+
+  int64_t FillWithRows(Grid<int, 2> & io_grid) {
+    for (auto [location, cells] : io_grid.GetRows()) {
+      int const y = location.y;
+
+      for (int x = 0; x < int(cells.size()); ++x) {
+        cells[x] = x ^ y;
+      }
+    }
+
+    return io_grid[ivec2(1, 1)];
+  }
+
+  // Returns the fastest of a few runs in nanoseconds per cell read. The totals are summed into
+  // io_checksum so the reads can't be optimized away.
+  template <typename Function>
+  double TimeReads(Function const & function, int64_t reads, int64_t & io_checksum) {
+    double bestNs = 0.0;
+
+    for (int i = 0; i < c_repeats; ++i) {
+      auto const startTime = std::chrono::steady_clock::now();
+
+      io_checksum += function();
+
+      std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - startTime;
+
+      if (i == 0 || elapsed.count() < bestNs) {
+        bestNs = elapsed.count();
+      }
+    }
+
+    return bestNs / double(reads);
+  }
+
+  template <typename Layout>
+  void RunLayout(char const * name, std::vector<ivec2> const & spots) {
+    Grid<int, 2, Layout> grid(c_gridSize);
+
+    for (ivec2 i; i != c_gridSize; i = grid.GetNextCoord(i, c_gridSize)) {
+      grid[i] = (i.x * 7 + i.y * 13) & 0xFF;
+    }
+
+    int64_t      checksum  = 0;
+    int64_t const interior = int64_t(c_gridSize.x - 2) * (c_gridSize.y - 2);
+
+    double const randomNs  = TimeReads([&]() { return ScanRandomNeighborhoods(grid, spots); }, int64_t(spots.size()) * 9, checksum);
+    double const sweepNs   = TimeReads([&]() { return SweepNeighborhoods(grid); }, interior * 9, checksum);
+    double const rowsNs    = TimeReads([&]() { return WalkRows(grid); }, c_gridSize.Product(), checksum);
+    double const columnsNs = TimeReads([&]() { return WalkColumns(grid); }, c_gridSize.Product(), checksum);
+
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(2)
+      << std::setw(12) << randomNs
+      << std::setw(12) << sweepNs
+      << std::setw(12) << rowsNs
+      << std::setw(12) << columnsNs
+      << "   (checksum " << checksum << ")" << std::endl;
+  }
+
+  void RunAlgorithm(char const * name, GridParallelism const & parallelism) {
+    Grid<int, 2> grid(c_gridSize, 1);
+    Grid<int, 2> other(c_gridSize, 1);
+
+    int64_t       checksum = 0;
+    int64_t const cells    = c_gridSize.Product();
+
+    auto const add = [](int64_t total, int64_t value) { return total + value; };
+
+    double const fillNs  = TimeReads([&]() { FillGrid(grid, 3, parallelism); return grid[ivec2(1, 1)]; }, cells, checksum);
+    double const sumNs   = TimeReads([&]() { return ReduceGrid(grid, int64_t(0), add, parallelism); }, cells, checksum);
+    double const copyNs  = TimeReads([&]() { CopyGrid(grid, other, parallelism); return other[ivec2(1, 1)]; }, cells, checksum);
+    double const equalNs = TimeReads([&]() { return int64_t(AreGridsEqual(grid, other, parallelism)); }, cells, checksum);
+
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(2)
+      << std::setw(12) << fillNs
+      << std::setw(12) << sumNs
+      << std::setw(12) << copyNs
+      << std::setw(12) << equalNs
+      << "   (checksum " << checksum << ")" << std::endl;
+  }
+
+  void RunIteration(void) {
+    Grid<int, 2> grid(c_gridSize);
+
+    for (ivec2 i; i != c_gridSize; i = grid.GetNextCoord(i, c_gridSize)) {
+      grid[i] = (i.x * 7 + i.y * 13) & 0xFF;
+    }
+
+    int64_t       checksum = 0;
+    int64_t const cells    = c_gridSize.Product();
+
+    double const sumNextCoordNs  = TimeReads([&]() { return SumWithNextCoord(grid); }, cells, checksum);
+    double const sumCellsNs      = TimeReads([&]() { return SumWithCells(grid); }, cells, checksum);
+    double const sumRowsNs       = TimeReads([&]() { return SumWithRows(grid); }, cells, checksum);
+    double const fillNextCoordNs = TimeReads([&]() { return FillWithNextCoord(grid); }, cells, checksum);
+    double const fillCellsNs     = TimeReads([&]() { return FillWithCells(grid); }, cells, checksum);
+    double const fillRowsNs      = TimeReads([&]() { return FillWithRows(grid); }, cells, checksum);
+
+    std::cout << std::fixed << std::setprecision(2)
+      << "  " << std::left << std::setw(14) << "GetNextCoord" << std::right << std::setw(12) << sumNextCoordNs << std::setw(12) << fillNextCoordNs << std::endl
+      << "  " << std::left << std::setw(14) << "GetCells" << std::right << std::setw(12) << sumCellsNs << std::setw(12) << fillCellsNs << std::endl
+      << "  " << std::left << std::setw(14) << "GetRows" << std::right << std::setw(12) << sumRowsNs << std::setw(12) << fillRowsNs
+      << "   (checksum " << checksum << ")" << std::endl;
+  }
+}
+
+int main(void) {
+  // The same spots for every layout, away from the edges so every neighborhood is whole.
+  std::mt19937                       random(1234);
+  std::uniform_int_distribution<int> spotX(1, c_gridSize.x - 2);
+  std::uniform_int_distribution<int> spotY(1, c_gridSize.y - 2);
+  std::vector<ivec2>                 spots(c_randomSpots);
+
+  for (ivec2 & spot : spots) {
+    spot = ivec2(spotX(random), spotY(random));
+  }
+
+  std::cout << "Grid<int, 2> " << c_gridSize.x << "x" << c_gridSize.y << ", ns per cell read, best of " << c_repeats << std::endl;
+  std::cout << "  " << std::left << std::setw(14) << "layout" << std::right
+    << std::setw(12) << "random 3x3"
+    << std::setw(12) << "3x3 sweep"
+    << std::setw(12) << "rows"
+    << std::setw(12) << "columns" << std::endl;
+
+  RunLayout<RowMajorGridLayout>("row-major", spots);
+  RunLayout<TiledGridLayout<8>>("tiled 8", spots);
+  RunLayout<TiledGridLayout<16>>("tiled 16", spots);
+  RunLayout<MortonGridLayout<8>>("Morton 8", spots);
+  RunLayout<MortonGridLayout<16>>("Morton 16", spots);
+
+  std::cout << std::endl << "Visiting every cell of a row-major grid, ns per cell" << std::endl;
+  std::cout << "  " << std::left << std::setw(14) << "loop" << std::right
+    << std::setw(12) << "sum"
+    << std::setw(12) << "fill" << std::endl;
+
+  RunIteration();
+
+  int const hardwareThreads = std::max(1, int(std::thread::hardware_concurrency()));
+
+  std::cout << std::endl << "Grid algorithms on " << hardwareThreads << " hardware threads, ns per cell" << std::endl;
+  std::cout << "  " << std::left << std::setw(14) << "threads" << std::right
+    << std::setw(12) << "fill"
+    << std::setw(12) << "sum"
+    << std::setw(12) << "copy"
+    << std::setw(12) << "equal" << std::endl;
+
+  RunAlgorithm("1", GridParallelism());
+  RunAlgorithm("all", GridParallelism { hardwareThreads });
+
+  return 0;
+}
@@ -105,9 +105,9 @@ int main(void) {
   while (!shouldEnd) {
     inputManager->ProcessInput();
 
-    for (ivec2 location; location != screen.GetSize(); location = screen.GetNextCoord(location, screen.GetSize())) {
+    for (auto [location, cell] : screen.GetCells()) {
       if (CellExistsForLocation(location)) {
-        screen[location].backgroundColor = gridColors[GetCellForLocation(location)];
+        cell.backgroundColor = gridColors[GetCellForLocation(location)];
       }
     }
 
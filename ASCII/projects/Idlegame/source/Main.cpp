@@ -657,9 +657,9 @@ namespace {
       }
     }
 
-    for (ivec2 i; i != io_lakes.GetSize(); i = io_lakes.GetNextCoord(i, io_lakes.GetSize())) {
+    for (auto [i, terrain] : io_lakes.GetCells()) {
       if (associations[i] != biggestIsland) {
-        io_lakes[i] = TerrainType::Lake;
+        terrain = TerrainType::Lake;
       }
     }
   }
@@ -679,13 +679,13 @@ namespace {
 
     PerlinNoise noise(forestInfo.detail);
 
-    for (ivec2 index; index != size; index = result.GetNextCoord(index, size)) {
+    for (auto [index, terrain] : result.GetCells()) {
       fvec2 const noiseLocation = fvec2(index) / fvec2(size - ivec2(1, 1));
 
       float const roughnessShift = (GetRandomValue() - 0.5f) * forestInfo.roughness;
 
       if (noise.GetValue(noiseLocation) + roughnessShift < forestInfo.density) {
-        result[index] = TerrainType::Forest;
+        terrain = TerrainType::Forest;
       }
     }
 
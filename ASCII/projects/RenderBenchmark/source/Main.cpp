@@ -0,0 +1,200 @@
+/*
+ * Copywrite 2026 Dodge Lafnitzegger
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include "GLFW/glfw3.h"
+#include "Window/Layers.h"
+#include "Window/Window.h"
+
+namespace {
+  ivec2 const c_gridSize     = ivec2(400, 200);
+  ivec2 const c_hudSize      = ivec2(60, 8);
+  ivec2 const c_hudOffset    = ivec2(10, 4);
+  int const   c_warmupFrames = 30;
+  int const   c_timedFrames  = 300;
+
+  enum class HudMode {
+    None,
+    Baked,
+    Layer
+  };
+
+  struct BenchmarkCase {
+    char const *    name;
+    AsciiRenderMode renderMode;
+    bool            changeEveryCell;
+    HudMode         hudMode;
+    bool            isPaletteCycling;
+    bool            isCapturing;
+    bool            isPacked;
+  };
+
+  BenchmarkCase const c_cases[] = {
+    { "GeometryShader, static",        AsciiRenderMode::GeometryShader, false, HudMode::None,  false, false, false },
+    { "GeometryShader, full",          AsciiRenderMode::GeometryShader, true,  HudMode::None,  false, false, false },
+    { "GeometryShader, full packed",   AsciiRenderMode::GeometryShader, true,  HudMode::None,  false, false, true  },
+    { "GeometryShader, palette cycle", AsciiRenderMode::GeometryShader, false, HudMode::None,  true,  false, false },
+    { "GeometryShader, capturing",     AsciiRenderMode::GeometryShader, true,  HudMode::None,  false, true,  false },
+    { "InstancedQuads, static",        AsciiRenderMode::InstancedQuads, false, HudMode::None,  false, false, false },
+    { "InstancedQuads, full",          AsciiRenderMode::InstancedQuads, true,  HudMode::None,  false, false, false },
+    { "InstancedQuads, full packed",   AsciiRenderMode::InstancedQuads, true,  HudMode::None,  false, false, true  },
+    { "InstancedQuads, baked HUD",     AsciiRenderMode::InstancedQuads, false, HudMode::Baked, false, false, false },
+    { "InstancedQuads, HUD layer",     AsciiRenderMode::InstancedQuads, false, HudMode::Layer, false, false, false },
+    { "CellTexture, static",           AsciiRenderMode::CellTexture,    false, HudMode::None,  false, false, false },
+    { "CellTexture, full",             AsciiRenderMode::CellTexture,    true,  HudMode::None,  false, false, false },
+    { "CellTexture, full packed",      AsciiRenderMode::CellTexture,    true,  HudMode::None,  false, false, true  },
+    { "CellTexture, palette cycle",    AsciiRenderMode::CellTexture,    false, HudMode::None,  true,  false, false },
+    { "CellTexture, capturing",        AsciiRenderMode::CellTexture,    true,  HudMode::None,  false, true,  false },
+    { "CellTexture, baked HUD",        AsciiRenderMode::CellTexture,    false, HudMode::Baked, false, false, false },
+    { "CellTexture, HUD layer",        AsciiRenderMode::CellTexture,    false, HudMode::Layer, false, false, false },
+  };
+
+
+  struct BenchmarkResult {
+    double msPerFrame;
+    double p99Ms;
+    int    glCallsPerFrame;
+    int    capturedFrames;
+    int    droppedFrames;
+  };
+
+  void FillGrid(Grid<AsciiCell, 2> & io_grid, int frame) {
+    for (int i = 0; i < io_grid.Count(); ++i) {
+      io_grid.Data()[i] = AsciiCell(char('!' + (i + frame) % 94), (i + frame) % FontColorCount, frame % FontColorCount);
+    }
+  }
+
+  // The same cells as FillGrid, written straight into the packed format.
+  void FillPackedGrid(Grid<AsciiPackedCell, 2> & io_grid, int frame) {
+    for (int i = 0; i < io_grid.Count(); ++i) {
+      io_grid.Data()[i] = AsciiPackedCell('!' + (i + frame) % 94, (i + frame) % FontColorCount, frame % FontColorCount);
+    }
+  }
+
+  // A menu over the map. The border is opaque and the text floats over a transparent background.
+  void FillHud(Grid<AsciiCell, 2> & io_hud, int frame) {
+    ivec2 const size = io_hud.GetSize();
+
+    for (int y = 0; y < size.y; ++y) {
+      for (int x = 0; x < size.x; ++x) {
+        bool const isBorder = x == 0 || y == 0 || x == size.x - 1 || y == size.y - 1;
+
+        io_hud[ivec2(x, y)] = isBorder ? AsciiCell('#', 7, 0) : AsciiCell(char('0' + (x + frame) % 10), 7, TransparentColor);
+      }
+    }
+  }
+
+  BenchmarkResult RunCase(BenchmarkCase const & benchmarkCase) {
+    AsciiWindow window(benchmarkCase.renderMode);
+
+    // Measure the renderer rather than the display's refresh rate.
+    glfwSwapInterval(0);
+
+    AsciiFont font = window.GetFont();
+    for (int i = 0; i < PaletteColorCount; ++i) {
+      font.colors[i] = Color((unsigned char)(i * 8), (unsigned char)(255 - i * 8), 128);
+    }
+
+    // Every cell changes color each frame, but only the palette time is sent.
+    if (benchmarkCase.isPaletteCycling) {
+      font.cycles[0] = PaletteCycle{ 0, FontColorCount, 16, true };
+    }
+    window.SetFont(font);
+
+    Grid<AsciiCell, 2> grid(c_gridSize);
+    FillGrid(grid, 0);
+
+    Grid<AsciiPackedCell, 2> packedGrid(c_gridSize);
+    FillPackedGrid(packedGrid, 0);
+
+    Grid<AsciiCell, 2> hud(c_hudSize);
+    Grid<AsciiCell, 2> baked;
+    AsciiLayer const   layers[] = { AsciiLayer(grid), AsciiLayer(hud, c_hudOffset) };
+
+    for (int i = 0; i < c_warmupFrames; ++i) {
+      if (benchmarkCase.isPacked) {
+        window.DrawPacked(packedGrid);
+      }
+      else {
+        window.Draw(grid);
+      }
+    }
+
+    window.SetFrameTimeMeasurement(true);
+
+    // Counting is all the callback does, so this measures the readback rather than a sink.
+    int capturedFrames = 0;
+    if (benchmarkCase.isCapturing) {
+      window.StartCapture([&capturedFrames](AsciiCapturedFrame const &) {
+        ++capturedFrames;
+      });
+    }
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < c_timedFrames; ++i) {
+      if (benchmarkCase.changeEveryCell) {
+        if (benchmarkCase.isPacked) {
+          FillPackedGrid(packedGrid, i);
+        }
+        else {
+          FillGrid(grid, i);
+        }
+      }
+
+      if (benchmarkCase.isPacked) {
+        window.DrawPacked(packedGrid);
+      }
+      else if (benchmarkCase.hudMode == HudMode::None) {
+        window.Draw(grid);
+      }
+      else {
+        FillHud(hud, i);
+
+        // Baking is what a single grid window forces: the whole screen is rebuilt to change the HUD.
+        if (benchmarkCase.hudMode == HudMode::Baked) {
+          CompositeLayers(c_gridSize, layers, baked);
+          window.Draw(baked);
+        }
+        else {
+          window.DrawLayers(c_gridSize, layers);
+        }
+      }
+      window.PollInput();
+    }
+
+    std::chrono::duration<double, std::milli> const elapsed = std::chrono::steady_clock::now() - startTime;
+
+    window.StopCapture();
+
+    BenchmarkResult result;
+    result.msPerFrame      = elapsed.count() / c_timedFrames;
+    result.p99Ms           = double(window.GetFrameTimes().GetPercentileNs(0.99f)) / 1000000.0;
+    result.glCallsPerFrame = window.GetGlCallCount();
+    result.capturedFrames  = capturedFrames;
+    result.droppedFrames   = window.GetDroppedCaptureFrames();
+
+    return result;
+  }
+}
+
+int main(void) {
+  std::cout << "Grid " << c_gridSize.x << "x" << c_gridSize.y << ", " << c_timedFrames << " frames per case" << std::endl;
+
+  for (BenchmarkCase const & benchmarkCase : c_cases) {
+    BenchmarkResult const result = RunCase(benchmarkCase);
+
+    std::cout << "  " << benchmarkCase.name << ": " << result.msPerFrame << " ms/frame (" << 1000.0 / result.msPerFrame << " fps), p99 " << result.p99Ms << " ms, " << result.glCallsPerFrame << " GL calls/frame";
+
+    if (benchmarkCase.isCapturing) {
+      std::cout << ", " << result.capturedFrames << " captured, " << result.droppedFrames << " dropped";
+    }
+
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
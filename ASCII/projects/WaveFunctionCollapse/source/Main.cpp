@@ -7,6 +7,8 @@
 #include <queue>
 
 #include "Containers/DynamicArray.h"
+#include "Containers/GridAlgorithms.h"
+#include "Containers/GridView.h"
 #include "Math/Vector.h"
 #include "Window/Window.h"
 
@@ -58,71 +60,41 @@ namespace {
     return ivec2(leftBoundary, 0);
   }
 
-  Grid<AsciiCell, 2> SetBuffer(
-    Grid<AsciiCell, 2> const & screen,
-    int                        bufferIndex,
-    Grid<AsciiCell, 2> const & buffer
-  ) {
-    Grid<AsciiCell, 2> result = screen;
-
-    ivec2 const c_bufferSize = ivec2(c_width, c_height);
-
-    for (ivec2 i; i != c_bufferSize; i = result.GetNextCoord(i, c_bufferSize)) {
-      ivec2 const coord = GetBufferTopLeft(bufferIndex) + i;
-
-      result[coord] = buffer[i];
-    }
-
-    return result;
+  GridView<AsciiCell, 2> GetBuffer(Grid<AsciiCell, 2> & screen, int bufferIndex) {
+    return GridView<AsciiCell, 2>(screen, GetBufferTopLeft(bufferIndex), c_bufferSize);
   }
 
-  Grid<AsciiCell, 2> GetBuffer(
-    Grid<AsciiCell, 2> const & screen,
-    int                        bufferIndex
-  ) {
-    Grid<AsciiCell, 2> result(ivec2(c_width, c_height));
-
-    for (ivec2 i; i != c_bufferSize; i = result.GetNextCoord(i, c_bufferSize)) {
-      ivec2 const coord = GetBufferTopLeft(bufferIndex) + i;
-
-      result[i] = screen[coord];
-    }
-
-    return result;
+  ConstGridView<AsciiCell, 2> GetBuffer(Grid<AsciiCell, 2> const & screen, int bufferIndex) {
+    return ConstGridView<AsciiCell, 2>(screen, GetBufferTopLeft(bufferIndex), c_bufferSize);
   }
 
-  Grid<int, 2> GetEvalGridFromBuffer(Grid<AsciiCell, 2> const & buffer) {
+  Grid<int, 2> GetEvalGridFromBuffer(ConstGridView<AsciiCell, 2> const & buffer) {
     Grid<int, 2> result(buffer.GetSize());
 
-    for (ivec2 i; i != buffer.GetSize(); i = buffer.GetNextCoord(i, buffer.GetSize())) {
-      if (buffer[i].backgroundColor == c_backgroundColorIndex) {
+    for (auto [i, cell] : buffer.GetCells()) {
+      if (cell.backgroundColor == c_backgroundColorIndex) {
         result[i] = c_unsetValue;
       }
       else {
-        result[i] = c_paintToValueMap[buffer[i].backgroundColor];
+        result[i] = c_paintToValueMap[cell.backgroundColor];
       }
     }
 
     return result;
   }
 
-  Grid<AsciiCell, 2> GetBufferFromEvalGrid(Grid<int, 2> const & evalGrid) {
-    Grid<AsciiCell, 2> result(evalGrid.GetSize());
-
-    for (ivec2 i; i != evalGrid.GetSize(); i = evalGrid.GetNextCoord(i, evalGrid.GetSize())) {
-
+  void DrawEvalGridToBuffer(Grid<int, 2> const & evalGrid, GridView<AsciiCell, 2> const & buffer) {
+    for (auto [i, cell] : buffer.GetCells()) {
       if (evalGrid[i] == c_unsetValue) {
-        result[i].backgroundColor = c_backgroundColorIndex;
+        cell.backgroundColor = c_backgroundColorIndex;
       }
       else {
-        result[i].backgroundColor = c_paintIndices[evalGrid[i]];
+        cell.backgroundColor = c_paintIndices[evalGrid[i]];
       }
 
-      result[i].foregroundColor = c_utilityColorIndex;
-      result[i].character       = ' ';
+      cell.foregroundColor = c_utilityColorIndex;
+      cell.character       = ' ';
     }
-
-    return result;
   }
 
   using EvalKey = ivec<c_evalKeySize>;
@@ -468,11 +440,8 @@ int main(void) {
     screenPainMask[ivec2(seperator1X, i)] = false;
   }
 
-  for (ivec2 i; i != c_menuSize; i = screenPainMask.GetNextCoord(i, c_menuSize)) {
-    screenPainMask[i] = false;
-    screen[i].foregroundColor = c_utilityColorIndex;
-    screen[i].backgroundColor = c_backgroundColorIndex;
-  }
+  FillGrid(GridView<int, 2>(screenPainMask, ivec2(), c_menuSize), false);
+  FillGrid(GridView<AsciiCell, 2>(screen, ivec2(), c_menuSize), AsciiCell(c_utilityColorIndex, c_backgroundColorIndex));
 
   ivec2 mousePos;
   bool  mouseDown = false;
@@ -607,7 +576,7 @@ int main(void) {
         }
       }
 
-      screen = SetBuffer(screen, toBuffer, GetBufferFromEvalGrid(runData.grid));
+      DrawEvalGridToBuffer(runData.grid, GetBuffer(screen, toBuffer));
 
       if (!runData.workQueue.empty()) {
         ivec2 const workLocation = runData.workQueue.top().location;